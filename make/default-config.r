@@ -34,6 +34,14 @@ optimize: 2
 standard: 'c ;one of: 'c, 'gnu89, 'gnu99, 'c99, 'c11, 'c++, 'c++98, 'c++0x, 'c++11, 'c++14 or 'c++17
 rigorous: no
 
+; yes to let SORT split large sorts across POSIX threads (see
+; system/options/sort-threads)
+parallel-sort: no
+
+; yes to let the garbage collector split the sweep of a large heap across
+; POSIX threads (see system/options/sweep-threads)
+parallel-sweep: no
+
 static: no
 pkg-config: get-env "PKGCONFIG" ;path to pkg-config, or default
 with-ffi: 'dynamic
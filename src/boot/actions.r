@@ -330,6 +330,7 @@ sort: action [
     limit [any-number! any-series!] {Length of series to sort}
     /all {Compare all fields}
     /reverse {Reverse sort order}
+    /stable {Keep values that compare equal in the order they were in}
 ]
 
 ;-- Port actions:
@@ -138,6 +138,32 @@ options: construct [] [  ; Options supplied to REBOL during startup
 
     binary-base: 16    ; Default base for FORMed binary values (64, 16, 2)
     decimal-digits: 15 ; Max number of decimal digits to print.
+
+    ; Percentage the heap may grow past the live data found by a recycle
+    ; before the next automatic one (BLANK! keeps RECYCLE/BALLAST fixed)
+    ;
+    recycle-growth: 100
+
+    ; Let automatic recycles resume evaluation after marking, and free the
+    ; garbage as allocations need the memory (RECYCLE always sweeps fully)
+    ;
+    lazy-sweep: true
+
+    ; Empty segments each memory pool keeps after a recycle, instead of
+    ; giving them back to the system (BLANK! keeps all of them)
+    ;
+    pool-reserve: 2
+
+    ; Threads a large SORT without a /COMPARE function may be split across,
+    ; if built with PARALLEL_SORT=yes (BLANK! uses one for each processor)
+    ;
+    sort-threads: _
+
+    ; Threads that a RECYCLE's sweep of a large heap may be split across, if
+    ; built with PARALLEL_SWEEP=yes (BLANK! uses one for each processor)
+    ;
+    sweep-threads: _
+
     module-paths: [%./]
     default-suffix: %.reb ; Used by IMPORT if no suffix is provided
     file-types: []
@@ -410,6 +436,22 @@ standard: construct [] [
         made-blocks:
         made-objects:
         recycles:
+        word-fetch-hits:    ; evaluator reused a lookahead fetch of a WORD!
+        word-fetch-misses:  ; evaluator had to look up a WORD!'s variable
+            _
+    ]
+
+    recycle-stats: construct [] [ ; see STATS/RECYCLE
+        recycles:       ; number of garbage collections run
+        pause-last:     ; duration of most recent collection (time!)
+        pause-max:      ; longest collection seen so far
+        pause-total:    ; sum of all collection pauses
+        mark-last:      ; marking portion of most recent pause
+        sweep-last:     ; sweeping portion of most recent pause
+        survival:       ; percent of managed series surviving last sweep
+        live-bytes:     ; estimated bytes in use after last sweep
+        ballast:        ; bytes that may be allocated before next recycle
+        released:       ; bytes of empty pool segments given back to system
             _
     ]
 
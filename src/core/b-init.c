@@ -1019,6 +1019,7 @@ void Startup_Task(void)
     Startup_Scanner();
     Startup_Mold(MIN_COMMON/4);
     Startup_Collector();
+    Startup_Parse();
 
     // Symbols system not initialized, can't init the errors just yet
     //
@@ -1286,6 +1287,7 @@ void Startup_Core(void)
     //
     PG_Do = &Do_Core;
     PG_Apply = &Apply_Core;
+    PG_Timed_Apply = &Apply_Core;
 
     // boot->natives is from the automatically gathered list of natives found
     // by scanning comments in the C sources for `native: ...` declarations.
@@ -1490,6 +1492,11 @@ REBCTX *Startup_Mezzanine(
 //
 void Shutdown_Core(void)
 {
+    // A sweep left pending by the last automatic recycle has to be done while
+    // the task variables it updates are still around.
+    //
+    Finish_Lazy_Sweep();
+
 #if !defined(NDEBUG)
     //
     // This memory check from R3-Alpha is somewhat superfluous, but include a
@@ -1518,6 +1525,7 @@ void Shutdown_Core(void)
     Shutdown_CRC();
     Shutdown_Mold();
     Shutdown_Scanner();
+    Shutdown_Parse();
     Shutdown_Char_Cases();
 
     Shutdown_Symbols();
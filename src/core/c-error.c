@@ -63,6 +63,7 @@ void Snap_State_Core(struct Reb_State *s)
     s->manuals_len = SER_LEN(GC_Manuals);
     s->uni_buf_len = SER_LEN(UNI_BUF);
     s->mold_loop_tail = ARR_LEN(TG_Mold_Stack);
+    s->timing_depth = TG_Timing_Depth;
 
     // !!! Is this initialization necessary?
     s->error = NULL;
@@ -140,6 +141,7 @@ void Assert_State_Balanced_Debug(
 
     assert(s->uni_buf_len == SER_LEN(UNI_BUF));
     assert(s->mold_loop_tail == ARR_LEN(TG_Mold_Stack));
+    assert(s->timing_depth == TG_Timing_Depth);
 
     assert(s->error == NULL); // !!! necessary?
 }
@@ -219,6 +221,12 @@ REBOOL Trapped_Helper_Halted(struct Reb_State *s)
 
     SET_SERIES_LEN(TG_Mold_Stack, s->mold_loop_tail);
 
+    // Timed function calls that were interrupted never returned to the
+    // Apply_Core_Timed() that would have popped them (see %d-profile.c).
+    //
+    if (TG_Timing_Depth != s->timing_depth)
+        Drop_Timing_Calls(s->timing_depth);
+
     Saved_State = s->last_state;
     Stack_Limit = s->stack_limit;
 
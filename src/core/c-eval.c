@@ -81,6 +81,21 @@
 #endif
 
 
+// Debug builds tally whether each WORD! the evaluator needs the variable of
+// was already fetched by a lookahead (see notes on f->gotten in Do_Core()),
+// or had to be looked up.  STATS/PROFILE reports the counts.
+//
+#if defined(NDEBUG)
+    #define COUNT_WORD_FETCH(gotten) \
+        NOOP
+#else
+    #define COUNT_WORD_FETCH(gotten) \
+        ((gotten) == END \
+            ? cast(void, ++PG_Reb_Stats->Word_Fetch_Misses) \
+            : cast(void, ++PG_Reb_Stats->Word_Fetch_Hits))
+#endif
+
+
 //
 //  Apply_Core: C
 //
@@ -371,8 +386,8 @@ reevaluate:;
     // to expansion.  Basically any function call invalidates f->gotten, as
     // does obviously any Fetch_Next_In_Frame (because the position changes)
     //
-    // !!! Review how often gotten has hits vs. misses, and what the benefit
-    // of the feature actually is.
+    // !!! Review what the benefit of the feature actually is.  Debug builds
+    // count how often gotten has hits vs. misses, see COUNT_WORD_FETCH().
 
     const RELVAL *current;
     const REBVAL *current_gotten;
@@ -397,6 +412,7 @@ reevaluate:;
         // to quote what's on its right!
         //
         if (f->eval_type == REB_WORD) {
+            COUNT_WORD_FETCH(current_gotten);
             if (current_gotten == END)
                 current_gotten = Get_Opt_Var_Else_End(current, f->specifier);
             else
@@ -472,6 +488,7 @@ reevaluate:;
             }
         }
 
+        COUNT_WORD_FETCH(END);
         f->gotten = Get_Opt_Var_Else_End(f->value, f->specifier);
 
         if (
@@ -1043,6 +1060,40 @@ reevaluate:;
    //=//// REGULAR ARG-OR-REFINEMENT-ARG (consumes a DO/NEXT's worth) ////=//
 
             case PARAM_CLASS_NORMAL:
+                //
+                // A literal like `1` or `[...]` evaluates to itself, unless
+                // an enfix function after it takes it as a left argument.
+                // Only a WORD! can dispatch enfix, so if the next value is
+                // not one (or is a word that isn't enfixed) the literal can
+                // be taken without pushing a subframe to evaluate it.  The
+                // next value is only peeked at when walking an array, and
+                // a word's lookup is kept in f->gotten as a subframe would.
+                //
+                if (
+                    (FLAGIT_KIND(VAL_TYPE(f->value)) & TS_INERT)
+                    && f->pending == NULL
+                ){
+                    const RELVAL *lookahead
+                        = ARR_AT(f->source.array, f->index);
+                    const REBVAL *lookahead_gotten = END;
+
+                    if (NOT_END(lookahead) && IS_WORD(lookahead)) {
+                        COUNT_WORD_FETCH(END);
+                        lookahead_gotten = Get_Opt_Var_Else_End(
+                            lookahead, f->specifier
+                        );
+                    }
+
+                    if (
+                        VAL_TYPE_OR_0(lookahead_gotten) != REB_FUNCTION
+                        || NOT_VAL_FLAG(lookahead_gotten, VALUE_FLAG_ENFIXED)
+                    ){
+                        Quote_Next_In_Frame(f->arg, f);
+                        f->gotten = lookahead_gotten;
+                        break;
+                    }
+                }
+
                 if (Do_Next_In_Subframe_Throws(
                     f->arg,
                     f,
@@ -1061,8 +1112,14 @@ reevaluate:;
                 // to a single-arity function "square".  But if the
                 // argument to square is declared #tight, it will act as
                 // `(square 1) + 2`, by not applying lookahead to
-                // see the + during the argument evaluation.
+                // see the + during the argument evaluation.  (So a literal
+                // never needs a subframe, see PARAM_CLASS_NORMAL above.)
                 //
+                if (FLAGIT_KIND(VAL_TYPE(f->value)) & TS_INERT) {
+                    Quote_Next_In_Frame(f->arg, f);
+                    break;
+                }
+
                 if (Do_Next_In_Subframe_Throws(
                     f->arg,
                     f,
@@ -1493,6 +1550,7 @@ reevaluate:;
 //==//////////////////////////////////////////////////////////////////////==//
 
     case REB_WORD:
+        COUNT_WORD_FETCH(current_gotten);
         if (current_gotten == END) {
             current_gotten = Get_Opt_Var_May_Fail(current, f->specifier);
             goto do_word_in_current_unchecked;
@@ -2029,6 +2087,7 @@ reevaluate:;
     }
     else if (f->eval_type == REB_WORD) {
 
+        COUNT_WORD_FETCH(f->gotten);
         if (f->gotten == END)
             f->gotten = Get_Opt_Var_Else_End(f->value, f->specifier);
         else
@@ -106,9 +106,19 @@ REBOOL Do_Signals_Throws(REBVAL *out)
 
     // "Be careful of signal loops! EG: do not PRINT from here."
 
+    if (GET_FLAG(filtered_sigs, SIG_SWEEP)) {
+        CLR_SIGNAL(SIG_SWEEP);
+        Sweep_Lazily();
+    }
+
     if (GET_FLAG(filtered_sigs, SIG_RECYCLE)) {
         CLR_SIGNAL(SIG_RECYCLE);
-        Recycle();
+        Recycle_Lazily();
+    }
+
+    if (GET_FLAG(filtered_sigs, SIG_PROFILE)) {
+        CLR_SIGNAL(SIG_PROFILE);
+        Sample_Stack();
     }
 
 #ifdef NOT_USED_INVESTIGATE
@@ -96,82 +96,85 @@ REBINT Get_Hash_Prime(REBCNT size)
 }
 
 
-// Removals from linear probing lists can be complex, because the same
-// overflow slot may be visited through different initial hashes:
 //
-// http://stackoverflow.com/a/279812/211160
+//  Make_Word_Table: C
 //
-// Since it's not enough to simply NULL out the spot when an interned string
-// is GC'd, a special pointer signaling "deletedness" is used.  It does not
-// cause a linear probe to terminate, but it is reused on insertions.
+// The table of canons is a power of 2 in size, so that a hash is turned into
+// a slot with a mask.  Alongside each canon pointer the full Hash_Word() of
+// its spelling is kept in PG_Canon_Hashes.  This lets a probe skip slots
+// which can't match with an integer compare instead of a Compare_UTF8().  It
+// also means moving canons to a bigger table, or shifting them back over one
+// that was removed, doesn't hash their spellings again.  (Removal does hash
+// the spelling being removed, to find its slot.)
 //
-static REBSTR PG_Deleted_Canon;
-#define DELETED_CANON &PG_Deleted_Canon
+// Both series are made before either is installed, so the globals never
+// pair a new table with the old table's hashes.
+//
+static void Make_Word_Table(REBCNT size)
+{
+    assert((size & (size - 1)) == 0); // must be a power of 2
+
+    REBSER *canons_by_hash = Make_Series_Core(
+        size, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
+    );
+    Clear_Series(canons_by_hash); // all slots start at NULL
+    SET_SERIES_LEN(canons_by_hash, size);
+
+    REBSER *hashes = Make_Series_Core(
+        size, sizeof(REBCNT), SERIES_FLAG_POWER_OF_2
+    );
+    SET_SERIES_LEN(hashes, size); // only meaningful if slot in use
+
+    PG_Canons_By_Hash = canons_by_hash;
+    PG_Canon_Hashes = hashes;
+}
 
 
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Expand the hash table part of the word_table by allocating a table twice
+// the size and moving all the canons of the current table into it, using
+// their saved hashes.  Free the old hash arrays.
 //
 static void Expand_Word_Table(void)
 {
     // The only full list of canon words available is the old hash table.
     // Hold onto it while creating the new hash table.
 
-    REBCNT old_size = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *old_canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
+    REBSER *old_canons = PG_Canons_By_Hash;
+    REBSER *old_hashes = PG_Canon_Hashes;
 
-    REBCNT new_size = Get_Hash_Prime(old_size + 1);
-    if (new_size == 0) {
+    REBCNT old_size = SER_LEN(old_canons);
+    if (old_size > MAX_I32 / 2) {
         DECLARE_LOCAL (temp);
         Init_Integer(temp, old_size + 1);
         fail (Error_Size_Limit_Raw(temp));
     }
 
-    assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(REBSTR*));
-
-    REBSER *ser = Make_Series_Core(
-        new_size, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
-    );
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, new_size);
-
-    // Rehash all the symbols:
+    Make_Word_Table(old_size * 2);
 
-    REBSTR **new_canons_by_hash = SER_HEAD(REBSER*, ser);
+    REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
+    REBCNT *hashes = SER_HEAD(REBCNT, PG_Canon_Hashes);
+    REBCNT mask = SER_LEN(PG_Canons_By_Hash) - 1;
 
     REBCNT n;
     for (n = 0; n < old_size; ++n) {
-        REBSTR *canon = old_canons_by_hash[n];
-
-        if (canon == NULL) continue;
-
-        if (canon == DELETED_CANON) { // clean out any deleted canon entries
-            --PG_Num_Canon_Slots_In_Use;
-        #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds; // keep track for shutdown assert
-        #endif
+        REBSTR *canon = SER_HEAD(REBSER*, old_canons)[n];
+        if (canon == NULL)
             continue;
-        }
 
-        REBINT hash = Hash_Word(STR_HEAD(canon), STR_NUM_BYTES(canon));
-        REBINT skip = (hash & 0x0000FFFF) % new_size;
-        if (skip == 0) skip = 1;
-        hash = (hash & 0x00FFFF00) % new_size;
+        REBCNT hash = SER_HEAD(REBCNT, old_hashes)[n];
+        REBCNT slot = hash & mask;
+        while (canons_by_hash[slot] != NULL)
+            slot = (slot + 1) & mask;
 
-        while (new_canons_by_hash[hash] != NULL) {
-            hash += skip;
-            if (hash >= cast(REBINT, new_size))
-                hash -= new_size;
-        }
-        new_canons_by_hash[hash] = canon;
+        canons_by_hash[slot] = canon;
+        hashes[slot] = hash;
     }
 
-    Free_Series(PG_Canons_By_Hash);
-    PG_Canons_By_Hash = ser;
+    Free_Series(old_canons);
+    Free_Series(old_hashes);
 }
 
 
@@ -201,27 +204,22 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
     //
     // For the hash search to be guaranteed to terminate, the table must be
     // large enough that we are able to find a NULL if there's a miss.  (It's
-    // actually kept larger than that, but to be on the right side of theory,
+    // actually kept at most half full, but to be on the right side of theory,
     // the table is always checked for expansion needs *before* the search.)
     //
-    REBCNT size = SER_LEN(PG_Canons_By_Hash);
-    if (PG_Num_Canon_Slots_In_Use > size / 2) {
+    if (PG_Num_Canon_Slots_In_Use >= SER_LEN(PG_Canons_By_Hash) / 2)
         Expand_Word_Table();
-        size = SER_LEN(PG_Canons_By_Hash); // got larger
-    }
 
     REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
+    REBCNT *hashes = SER_HEAD(REBCNT, PG_Canon_Hashes);
+    REBCNT mask = SER_LEN(PG_Canons_By_Hash) - 1;
 
-    // Calculate the starting hash slot to try--and the amount to skip to by
-    // each time a slot is found that is occupied by a non-match.
+    // The starting slot comes from the low bits of the hash, and collisions
+    // go to the next slot over.  Only slots whose canon has the same full
+    // hash need their spelling compared.
     //
     REBCNT hash = Hash_Word(utf8, len);
-    REBCNT skip = (hash & 0x0000FFFF) % size;
-    if (skip == 0)
-        skip = 1;
-    hash = (hash & 0x00FFFF00) % size;
-
-    REBSTR **deleted_slot = NULL;
+    REBCNT slot = hash & mask;
 
     // The hash table only indexes the canon form of each spelling.  So when
     // testing a slot to see if it's a match (or a collision that needs to
@@ -232,11 +230,9 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
     // returning 0 if it is.
     //
     REBSTR* canon;
-    while ((canon = canons_by_hash[hash]) != NULL) {
-        if (canon == DELETED_CANON) {
-            deleted_slot = &canons_by_hash[hash];
-            hash += skip;
-            if (hash >= size) hash -= size;
+    while ((canon = canons_by_hash[slot]) != NULL) {
+        if (hashes[slot] != hash) {
+            slot = (slot + 1) & mask;
             continue;
         }
 
@@ -246,16 +242,19 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
         // and is the exact interning to return.
         //
         REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, len);
-        if (cmp == 0) return canon;
+        if (cmp == 0) {
+            if (GC_Sweep_Next != NULL)
+                Premark_Node(NOD(canon)); // may be garbage not yet swept
+            return canon;
+        }
 
         if (cmp < 0) {
             //
             // Compare_UTF8 returns less than zero when the canon value in the
-            // slot isn't the same at all.  Since it's not a match, skip ahead
-            // to the next candidate slot--wrapping around if necessary
+            // slot isn't the same at all (a full hash collision).  Since it's
+            // not a match, go to the next slot--wrapping around if necessary
             //
-            hash += skip;
-            if (hash >= size) hash -= size;
+            slot = (slot + 1) & mask;
             continue;
         }
 
@@ -272,7 +271,11 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
             // Exact match for a synonym also means no new allocation needed.
             //
             cmp = Compare_UTF8(STR_HEAD(synonym), utf8, len);
-            if (cmp == 0) return synonym;
+            if (cmp == 0) {
+                if (GC_Sweep_Next != NULL)
+                    Premark_Node(NOD(synonym)); // (same as canon case)
+                return synonym;
+            }
 
             // Comparison should at least be a synonym, if in this list.
             // Keep checking for an exact match until a cycle is found.
@@ -282,9 +285,13 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, REBCNT len)
         }
 
         // If none of the synonyms matched, then this case variation needs
-        // to get its own interning, and point to the canon found.
+        // to get its own interning, and point to the canon found.  That
+        // canon may be garbage a pending sweep has yet to reach, and must
+        // be kept alive along with its new synonym.
 
         assert(canon != NULL);
+        if (GC_Sweep_Next != NULL)
+            Premark_Node(NOD(canon));
         goto new_interning; // break loop, make a new synonym
     }
 
@@ -319,19 +326,18 @@ new_interning: ; // semicolon needed for statement
     if (canon == NULL) {
         //
         // There was no canon symbol found, so this interning will be canon.
-        // Add it to the hash table and mark it, reuse deleted slot (if any)
+        // Add it to the hash table in the first NULL slot of its run.  That
+        // is where the search ended, unless making the series swept garbage
+        // spellings out of the table (see Load_Magazine()) and moved entries
+        // back into the holes, so the slot is looked for again.
         //
-        if (deleted_slot) {
-            *deleted_slot = intern; // slot "usage" count stays constant
+        slot = hash & mask;
+        while (canons_by_hash[slot] != NULL)
+            slot = (slot + 1) & mask;
 
-        #if !defined(NDEBUG)
-            --PG_Num_Canon_Deleteds;
-        #endif
-        }
-        else {
-            canons_by_hash[hash] = intern;
-            ++PG_Num_Canon_Slots_In_Use;
-        }
+        canons_by_hash[slot] = intern;
+        hashes[slot] = hash;
+        ++PG_Num_Canon_Slots_In_Use;
 
         SET_SER_INFO(intern, STRING_INFO_CANON);
 
@@ -411,62 +417,60 @@ void GC_Kill_Interning(REBSTR *intern)
     assert(intern->misc.bind_index.high == 0); // shouldn't GC during binds?
     assert(intern->misc.bind_index.low == 0);
 
-    REBCNT size = SER_LEN(PG_Canons_By_Hash);
     REBSTR* *canons_by_hash = SER_HEAD(REBSER*, PG_Canons_By_Hash);
-    assert(canons_by_hash != NULL);
+    REBCNT *hashes = SER_HEAD(REBCNT, PG_Canon_Hashes);
+    REBCNT mask = SER_LEN(PG_Canons_By_Hash) - 1;
 
     REBCNT len = STR_NUM_BYTES(intern);
     assert(len == LEN_BYTES(STR_HEAD(intern)));
 
     REBCNT hash = Hash_Word(STR_HEAD(intern), len);
-    REBCNT skip = (hash & 0x0000FFFF) % size;
-    if (skip == 0) skip = 1;
-    hash = (hash & 0x00FFFF00) % size;
+    REBCNT slot = hash & mask;
 
     // We *will* find the canon form in the hash table.
     //
-    while (canons_by_hash[hash] != intern) {
-        hash += skip;
-        if (hash >= size) hash -= size;
-    }
+    while (canons_by_hash[slot] != intern)
+        slot = (slot + 1) & mask;
+    assert(hashes[slot] == hash);
 
     if (synonym != intern) {
         //
         // If there was a synonym in the circularly linked list distinct from
         // the canon form, then it gets a promotion to being the canon form.
-        // It should hash the same, and be able to take over the hash slot.
+        // It hashes the same, and takes over the hash slot.
         //
     #ifdef SLOW_INTERN_HASH_DOUBLE_CHECK
-        assert(hash == Hash_Word(STR_HEAD(synonym)));
+        assert(hash == Hash_Word(STR_HEAD(synonym), STR_NUM_BYTES(synonym)));
     #endif
-        canons_by_hash[hash] = synonym;
+        canons_by_hash[slot] = synonym;
         SET_SER_INFO(synonym, STRING_INFO_CANON);
         synonym->misc.bind_index.low = 0;
         synonym->misc.bind_index.high = 0;
+        return;
     }
-    else {
-        // This canon form must be removed from the hash table.  Ripple the
-        // collision slots back until a NULL is found, to reduce search times.
-        //
-        REBCNT previous_hash = hash;
-        while (canons_by_hash[hash] != NULL) {
-            hash += skip;
-            if (hash >= size) hash -= size;
-            canons_by_hash[previous_hash] = canons_by_hash[hash];
-        }
 
-        // Signal that the hash slot is "deleted" via a special pointer.
-        // See notes on DELETED_SLOT for why the final slot in the collision
-        // chain can't just be left NULL:
-        //
-        // http://stackoverflow.com/a/279812/211160
-        //
-        canons_by_hash[previous_hash] = DELETED_CANON;
-
-    #if !defined(NDEBUG)
-        ++PG_Num_Canon_Deleteds; // total use same (PG_Num_Canons_Or_Deleteds)
-    #endif
+    // This canon form must be removed from the hash table.  Rather than
+    // leave a "deleted" marker that searches would have to step over, the
+    // entries after it in the collision run are shifted back into the hole,
+    // as long as that doesn't move one in front of its starting slot:
+    //
+    // https://en.wikipedia.org/wiki/Linear_probing#Deletion
+    //
+    REBCNT hole = slot;
+    while (TRUE) {
+        slot = (slot + 1) & mask;
+        if (canons_by_hash[slot] == NULL)
+            break;
+
+        REBCNT home = hashes[slot] & mask;
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            canons_by_hash[hole] = canons_by_hash[slot];
+            hashes[hole] = hashes[slot];
+            hole = slot;
+        }
     }
+    canons_by_hash[hole] = NULL;
+    --PG_Num_Canon_Slots_In_Use;
 }
 
 
@@ -515,33 +519,20 @@ REBINT Compare_Word(const RELVAL *s, const RELVAL *t, REBOOL strict)
 void Startup_Interning(void)
 {
     PG_Num_Canon_Slots_In_Use = 0;
-#if !defined(NDEBUG)
-    PG_Num_Canon_Deleteds = 0;
-#endif
 
-    // Start hash table out at a fixed size.  When collisions occur, it
-    // causes a skipping pattern that continues until it finds the desired
-    // slot.  The method is known as linear probing:
-    //
-    // https://en.wikipedia.org/wiki/Linear_probing
-    //
-    // It must always be at least as big as the total number of words, in order
-    // for it to uniquely be able to locate each symbol pointer.  But to
-    // reduce long probing chains, it should be significantly larger than that.
-    // R3-Alpha used a heuristic of 4 times as big as the number of words.
+    // Start hash table out at a fixed size.  It must always be bigger than
+    // the total number of words, in order for a search to end at a NULL slot
+    // on a miss.  But to keep linear probing runs short, it is kept at least
+    // twice that, and starts big enough for the words loaded at boot.
 
     REBCNT n;
 #if defined(NDEBUG)
-    n = Get_Hash_Prime(WORD_TABLE_SIZE * 4); // extra reduces rehashing
+    n = WORD_TABLE_SIZE * 4; // extra reduces rehashing
 #else
     n = 1; // forces exercise of rehashing logic in debug build
 #endif
 
-    PG_Canons_By_Hash = Make_Series_Core(
-        n, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
-    );
-    Clear_Series(PG_Canons_By_Hash); // all slots start at NULL
-    SET_SERIES_LEN(PG_Canons_By_Hash, n);
+    Make_Word_Table(n);
 }
 
 
@@ -636,6 +627,7 @@ void Shutdown_Symbols(void)
 //
 void Shutdown_Interning(void)
 {
-    assert(PG_Num_Canon_Slots_In_Use - PG_Num_Canon_Deleteds == 0);
+    assert(PG_Num_Canon_Slots_In_Use == 0);
     Free_Series(PG_Canons_By_Hash);
+    Free_Series(PG_Canon_Hashes);
 }
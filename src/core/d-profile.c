@@ -0,0 +1,1250 @@
+//
+//  File: %d-profile.c
+//  Summary: "Profilers for Series Allocations and Function Calls"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// The statistics in PG_Reb_Stats are only kept by debug builds, and only say
+// how much was allocated in total.  To find out what is generating garbage
+// in a program, PROFILE-ALLOCATIONS can be asked to sample every Nth series
+// node made by Make_Series_Core() or Alloc_Pairing().  Each sample is tallied
+// under the label of the function running at the time, and what kind of
+// series it is.
+//
+// When it is not running, the cost to allocation is one test of a global
+// countdown.  When it is running, the cost of a sample is a walk up to the
+// nearest function frame and a hash table update.  The table is allocated
+// with Alloc_Mem(), since series can't be made while making a series.
+//
+// TRACE shows every step of evaluation, which is too slow to find out where
+// the time goes in a real program.  PROFILE instead has an interval timer
+// raise SIG_PROFILE, so that the next Do_Signals_Throws() tallies the labels
+// of the function frames on the stack (with the file and line of the array
+// each was called from, if known).  Stacks are counted at sample time in a
+// hash table like the one for allocations, so memory use grows only with
+// the number of distinct stacks seen.  The report can be a block or the
+// "folded stacks" text that flame graph tools take as input.
+//
+// The timer measures processor time, so a program waiting on I/O or in WAIT
+// is not sampled.  It is only implemented for POSIX (SIGPROF).
+//
+// PROFILE-FUNCTIONS is exact instead of sampled, but slows every call down.
+// It swaps Apply_Core_Timed() into PG_Apply (as TRACE does with its own
+// hook), which times each call and tallies it under the function that was
+// called, with the time spent in the calls it made taken out as "self" time.
+// The calls still go through the hook it displaced, so TRACE keeps working.
+//
+
+#include "sys-core.h"
+
+#ifdef HAS_POSIX_SIGNAL
+    #include <signal.h>
+    #include <sys/time.h>
+#endif
+
+
+// What the series was made for, as far as can be told from its flags when
+// it is made.  (A BINARY! and a STRING! of byte-sized characters both just
+// look like bytes at this point.)
+//
+enum Reb_Alloc_Kind {
+    ALLOC_KIND_PAIRING,
+    ALLOC_KIND_SYMBOL,
+    ALLOC_KIND_VARLIST,
+    ALLOC_KIND_PARAMLIST,
+    ALLOC_KIND_PAIRLIST,
+    ALLOC_KIND_ARRAY,
+    ALLOC_KIND_BYTES,
+    ALLOC_KIND_STRING,
+    ALLOC_KIND_OTHER,
+    ALLOC_KIND_MAX
+};
+
+static const char *Alloc_Kind_Names[ALLOC_KIND_MAX] = {
+    "pairing",
+    "symbol",
+    "varlist",
+    "paramlist",
+    "pairlist",
+    "array",
+    "bytes",
+    "string",
+    "other"
+};
+
+
+//
+//  Rehash_Profile_Table: C
+//
+// The samples and timings kept for profiling are in hash tables that use
+// linear probing, and which are kept at most half full so probes are short.
+// This moves the entries of a table (given by pointers to its globals) into
+// `new_size` zeroed slots, which read as unused.  `place` puts each of the
+// old entries in its slot of the new table, and returns TRUE if that took a
+// slot (FALSE if the entry was unused, or was merged into another).
+//
+// Returns FALSE if memory wasn't available.
+//
+static REBOOL Rehash_Profile_Table(
+    void **table,
+    REBCNT *size,
+    REBCNT *used,
+    REBCNT wide,
+    REBCNT new_size,
+    REBOOL (*place)(const void *entry)
+){
+    REBYTE *old = cast(REBYTE*, *table);
+    REBCNT old_size = *size;
+
+    REBYTE *entries = ALLOC_N(REBYTE, new_size * wide);
+    if (entries == NULL)
+        return FALSE;
+    memset(entries, 0, new_size * wide);
+
+    *table = entries;
+    *size = new_size;
+    *used = 0;
+
+    REBCNT n;
+    for (n = 0; n < old_size; ++n) {
+        if ((*place)(old + n * wide))
+            ++*used;
+    }
+
+    if (old != NULL)
+        FREE_N(REBYTE, old_size * wide, old);
+
+    return TRUE;
+}
+
+// Tables start out with 64 slots, and double in size when half full.
+//
+#define GROWN_TABLE_SIZE(size) \
+    ((size) == 0 ? 64 : (size) * 2)
+
+
+//
+//  Find_Alloc_Sample: C
+//
+// Linear probing for the slot of a label and kind, which will be an unused
+// slot if they haven't been sampled yet.
+//
+static REB_ALLOC_SAMPLE *Find_Alloc_Sample(REBSTR *label, REBCNT kind)
+{
+    REBCNT mask = TG_Alloc_Samples_Size - 1;
+    REBCNT hash = cast(REBCNT, (cast(REBUPT, label) >> 4) * 31 + kind) & mask;
+
+    while (TRUE) {
+        REB_ALLOC_SAMPLE *sample = &TG_Alloc_Samples[hash];
+        if (NOT(sample->used))
+            return sample;
+        if (sample->label == label && sample->kind == kind)
+            return sample;
+        hash = (hash + 1) & mask;
+    }
+}
+
+
+//
+//  Place_Alloc_Sample: C
+//
+static REBOOL Place_Alloc_Sample(const void *entry)
+{
+    const REB_ALLOC_SAMPLE *old = cast(const REB_ALLOC_SAMPLE*, entry);
+    if (NOT(old->used))
+        return FALSE;
+
+    *Find_Alloc_Sample(old->label, old->kind) = *old;
+    return TRUE;
+}
+
+
+//
+//  Grow_Alloc_Samples: C
+//
+static REBOOL Grow_Alloc_Samples(void)
+{
+    return Rehash_Profile_Table(
+        cast(void**, &TG_Alloc_Samples),
+        &TG_Alloc_Samples_Size,
+        &TG_Alloc_Samples_Used,
+        sizeof(REB_ALLOC_SAMPLE),
+        GROWN_TABLE_SIZE(TG_Alloc_Samples_Size),
+        &Place_Alloc_Sample
+    );
+}
+
+
+//
+//  Sample_Allocation: C
+//
+// Called by Make_Series_Core() and Alloc_Pairing() when the countdown to the
+// next sample runs out.  (They test the countdown themselves, so that there
+// is no function call when no sample is due.)
+//
+void Sample_Allocation(REBSER *s)
+{
+    TG_Alloc_Sample_Countdown = TG_Alloc_Sample_Rate;
+
+    REBCNT kind;
+    REBCNT bytes = sizeof(REBSER);
+    if (s->header.bits & NODE_FLAG_CELL)
+        kind = ALLOC_KIND_PAIRING;
+    else {
+        if (GET_SER_INFO(s, SERIES_INFO_HAS_DYNAMIC))
+            bytes += Series_Allocation_Unpooled(s);
+
+        if (GET_SER_FLAG(s, SERIES_FLAG_UTF8_STRING))
+            kind = ALLOC_KIND_SYMBOL;
+        else if (GET_SER_FLAG(s, ARRAY_FLAG_VARLIST))
+            kind = ALLOC_KIND_VARLIST;
+        else if (GET_SER_FLAG(s, ARRAY_FLAG_PARAMLIST))
+            kind = ALLOC_KIND_PARAMLIST;
+        else if (GET_SER_FLAG(s, ARRAY_FLAG_PAIRLIST))
+            kind = ALLOC_KIND_PAIRLIST;
+        else if (GET_SER_FLAG(s, SERIES_FLAG_ARRAY))
+            kind = ALLOC_KIND_ARRAY;
+        else if (SER_WIDE(s) == sizeof(REBYTE))
+            kind = ALLOC_KIND_BYTES;
+        else if (SER_WIDE(s) == sizeof(REBUNI))
+            kind = ALLOC_KIND_STRING;
+        else
+            kind = ALLOC_KIND_OTHER;
+    }
+
+    // Attribute the allocation to the innermost function that is running,
+    // e.g. an APPEND that needed to expand its series.
+    //
+    REBFRM *f = FS_TOP;
+    while (f != NULL && NOT(Is_Any_Function_Frame(f)))
+        f = FRM_PRIOR(f);
+    REBSTR *label = (f == NULL) ? NULL : FRM_LABEL(f);
+
+    if (TG_Alloc_Samples_Used * 2 >= TG_Alloc_Samples_Size)
+        if (NOT(Grow_Alloc_Samples()))
+            return; // lose the sample rather than fail an allocation
+
+    REB_ALLOC_SAMPLE *sample = Find_Alloc_Sample(label, kind);
+    if (NOT(sample->used)) {
+        sample->used = 1;
+        sample->label = label;
+        sample->kind = kind;
+        ++TG_Alloc_Samples_Used;
+    }
+    ++sample->count;
+    sample->bytes += bytes;
+}
+
+
+//
+//  Free_Alloc_Samples: C
+//
+// The labels in the table are kept alive by the GC while it exists, so it is
+// freed before the shutdown recycle.
+//
+void Free_Alloc_Samples(void)
+{
+    TG_Alloc_Sample_Countdown = 0;
+
+    if (TG_Alloc_Samples != NULL)
+        FREE_N(REB_ALLOC_SAMPLE, TG_Alloc_Samples_Size, TG_Alloc_Samples);
+
+    TG_Alloc_Samples = NULL;
+    TG_Alloc_Samples_Size = 0;
+    TG_Alloc_Samples_Used = 0;
+}
+
+
+//
+//  Compare_Alloc_Samples: C
+//
+// Sort order for the report, most bytes first.
+//
+static int Compare_Alloc_Samples(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+
+    const REB_ALLOC_SAMPLE *s1 = *cast(REB_ALLOC_SAMPLE* const*, v1);
+    const REB_ALLOC_SAMPLE *s2 = *cast(REB_ALLOC_SAMPLE* const*, v2);
+    if (s1->bytes != s2->bytes)
+        return s1->bytes > s2->bytes ? -1 : 1;
+    if (s1->count != s2->count)
+        return s1->count > s2->count ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  profile-allocations: native [
+//
+//  {Sample series allocations, tallied by the running function and kind.}
+//
+//      return: [block! <opt>]
+//          {[label kind series bytes ...] estimated from samples, by bytes}
+//      /on
+//          "Clear any samples taken and start sampling"
+//      rate [integer!]
+//          "Sample one allocation in this many (1 means every allocation)"
+//      /off
+//          "Stop sampling (the samples are kept for reporting)"
+//  ]
+//
+REBNATIVE(profile_allocations)
+{
+    INCLUDE_PARAMS_OF_PROFILE_ALLOCATIONS;
+
+    if (REF(on)) {
+        if (VAL_INT64(ARG(rate)) < 1 || VAL_INT64(ARG(rate)) > MAX_I32)
+            fail (ARG(rate));
+
+        Free_Alloc_Samples();
+        if (NOT(Grow_Alloc_Samples()))
+            fail (Error_No_Memory(64 * sizeof(REB_ALLOC_SAMPLE)));
+
+        TG_Alloc_Sample_Rate = VAL_INT32(ARG(rate));
+        TG_Alloc_Sample_Countdown = TG_Alloc_Sample_Rate;
+        return R_VOID;
+    }
+
+    if (REF(off)) {
+        TG_Alloc_Sample_Countdown = 0;
+        return R_VOID;
+    }
+
+    // Don't let the report's own allocations be sampled while it's built.
+    //
+    REBCNT countdown = TG_Alloc_Sample_Countdown;
+    TG_Alloc_Sample_Countdown = 0;
+
+    REBCNT num = TG_Alloc_Samples_Used;
+    REB_ALLOC_SAMPLE **sorted = NULL;
+    if (num != 0) {
+        sorted = ALLOC_N(REB_ALLOC_SAMPLE*, num);
+        if (sorted == NULL) {
+            TG_Alloc_Sample_Countdown = countdown;
+            fail (Error_No_Memory(num * sizeof(REB_ALLOC_SAMPLE*)));
+        }
+
+        REBCNT i = 0;
+        REBCNT n;
+        for (n = 0; n < TG_Alloc_Samples_Size; ++n) {
+            if (TG_Alloc_Samples[n].used)
+                sorted[i++] = &TG_Alloc_Samples[n];
+        }
+        assert(i == num);
+
+        reb_qsort_r(
+            sorted, num, sizeof(REB_ALLOC_SAMPLE*), NULL, &Compare_Alloc_Samples
+        );
+    }
+
+    REBDSP dsp_orig = DSP;
+
+    REBCNT i;
+    for (i = 0; i < num; ++i) {
+        REB_ALLOC_SAMPLE *sample = sorted[i];
+
+        DS_PUSH_TRASH;
+        if (sample->label == NULL)
+            Init_Blank(DS_TOP);
+        else
+            Init_Word(DS_TOP, sample->label);
+
+        const char *name = Alloc_Kind_Names[sample->kind];
+        DS_PUSH_TRASH;
+        Init_Word(DS_TOP, Intern_UTF8_Managed(cb_cast(name), strlen(name)));
+
+        DS_PUSH_TRASH;
+        Init_Integer(DS_TOP, sample->count * TG_Alloc_Sample_Rate);
+
+        DS_PUSH_TRASH;
+        Init_Integer(DS_TOP, sample->bytes * TG_Alloc_Sample_Rate);
+    }
+
+    if (sorted != NULL)
+        FREE_N(REB_ALLOC_SAMPLE*, num, sorted);
+
+    Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+
+    TG_Alloc_Sample_Countdown = countdown;
+    return R_OUT;
+}
+
+
+//
+//  Same_Frame_Samples: C
+//
+// Fields are compared one by one, since the structs may contain padding.
+//
+static REBOOL Same_Frame_Samples(
+    const REB_FRAME_SAMPLE *a,
+    const REB_FRAME_SAMPLE *b,
+    REBCNT depth
+){
+    for (; depth > 0; --depth, ++a, ++b) {
+        if (a->label != b->label || a->file != b->file || a->line != b->line)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+
+//
+//  Find_Stack_Sample: C
+//
+// Linear probing for the slot of the stack whose frames are at `frames`,
+// which will be an unused slot if it hasn't been sampled yet.
+//
+static REB_STACK_SAMPLE *Find_Stack_Sample(
+    REBCNT hash,
+    const REB_FRAME_SAMPLE *frames,
+    REBCNT depth
+){
+    REBCNT mask = TG_Stack_Samples_Size - 1;
+    REBCNT n = hash & mask;
+
+    while (TRUE) {
+        REB_STACK_SAMPLE *sample = &TG_Stack_Samples[n];
+        if (NOT(sample->used))
+            return sample;
+        if (
+            sample->hash == hash
+            && sample->depth == depth
+            && Same_Frame_Samples(
+                &TG_Frame_Samples[sample->start], frames, depth
+            )
+        ){
+            return sample;
+        }
+        n = (n + 1) & mask;
+    }
+}
+
+
+//
+//  Place_Stack_Sample: C
+//
+static REBOOL Place_Stack_Sample(const void *entry)
+{
+    const REB_STACK_SAMPLE *old = cast(const REB_STACK_SAMPLE*, entry);
+    if (NOT(old->used))
+        return FALSE;
+
+    *Find_Stack_Sample(
+        old->hash, &TG_Frame_Samples[old->start], old->depth
+    ) = *old;
+    return TRUE;
+}
+
+
+//
+//  Grow_Stack_Samples: C
+//
+static REBOOL Grow_Stack_Samples(void)
+{
+    return Rehash_Profile_Table(
+        cast(void**, &TG_Stack_Samples),
+        &TG_Stack_Samples_Size,
+        &TG_Stack_Samples_Used,
+        sizeof(REB_STACK_SAMPLE),
+        GROWN_TABLE_SIZE(TG_Stack_Samples_Size),
+        &Place_Stack_Sample
+    );
+}
+
+
+//
+//  Reserve_Frame_Samples: C
+//
+// Make room for `more` frames past the ones in use, doubling the pool as
+// needed.  Returns FALSE if memory wasn't available.
+//
+static REBOOL Reserve_Frame_Samples(REBCNT more)
+{
+    REBCNT needed = TG_Frame_Samples_Used + more;
+    if (needed <= TG_Frame_Samples_Size)
+        return TRUE;
+
+    REBCNT size = (TG_Frame_Samples_Size == 0) ? 256 : TG_Frame_Samples_Size;
+    while (size < needed)
+        size *= 2;
+
+    REB_FRAME_SAMPLE *frames = ALLOC_N(REB_FRAME_SAMPLE, size);
+    if (frames == NULL)
+        return FALSE;
+
+    if (TG_Frame_Samples != NULL) {
+        memcpy(
+            frames,
+            TG_Frame_Samples,
+            sizeof(REB_FRAME_SAMPLE) * TG_Frame_Samples_Used
+        );
+        FREE_N(REB_FRAME_SAMPLE, TG_Frame_Samples_Size, TG_Frame_Samples);
+    }
+
+    TG_Frame_Samples = frames;
+    TG_Frame_Samples_Size = size;
+    return TRUE;
+}
+
+
+//
+//  Sample_Stack: C
+//
+// Called by Do_Signals_Throws() when the profiling timer has gone off.  The
+// function frames are written past the end of the frames in use, and only
+// kept if this stack hasn't been seen before.
+//
+void Sample_Stack(void)
+{
+    REBCNT depth = 0;
+    REBFRM *f;
+    for (f = FS_TOP; f != NULL; f = FRM_PRIOR(f)) {
+        if (Is_Any_Function_Frame(f))
+            ++depth;
+    }
+
+    if (TG_Stack_Samples_Used * 2 >= TG_Stack_Samples_Size)
+        if (NOT(Grow_Stack_Samples()))
+            return; // lose the sample rather than fail in a signal
+    if (NOT(Reserve_Frame_Samples(depth)))
+        return;
+
+    REB_FRAME_SAMPLE *frames = &TG_Frame_Samples[TG_Frame_Samples_Used];
+
+    REBCNT i = depth;
+    for (f = FS_TOP; f != NULL; f = FRM_PRIOR(f)) {
+        if (NOT(Is_Any_Function_Frame(f)))
+            continue;
+
+        REB_FRAME_SAMPLE *frame = &frames[--i];
+        frame->label = FRM_LABEL(f);
+        if (
+            NOT(FRM_IS_VALIST(f))
+            && GET_SER_FLAG(f->source.array, SERIES_FLAG_FILE_LINE)
+        ){
+            frame->file = SER(f->source.array)->link.filename;
+            frame->line = SER(f->source.array)->misc.line;
+        }
+        else {
+            frame->file = NULL;
+            frame->line = 0;
+        }
+    }
+    assert(i == 0);
+
+    REBCNT hash = depth;
+    for (i = 0; i < depth; ++i) {
+        hash = hash * 31 + cast(REBCNT, cast(REBUPT, frames[i].label) >> 4);
+        hash = hash * 31 + cast(REBCNT, cast(REBUPT, frames[i].file) >> 4);
+        hash = hash * 31 + frames[i].line;
+    }
+
+    REB_STACK_SAMPLE *sample = Find_Stack_Sample(hash, frames, depth);
+    if (NOT(sample->used)) {
+        sample->used = 1;
+        sample->hash = hash;
+        sample->start = TG_Frame_Samples_Used;
+        sample->depth = depth;
+        TG_Frame_Samples_Used += depth;
+        ++TG_Stack_Samples_Used;
+    }
+    ++sample->count;
+}
+
+
+#ifdef HAS_POSIX_SIGNAL
+
+static struct sigaction Prior_Profile_Action;
+
+//
+//  Handle_Profile_Signal: C
+//
+// Nothing can be done safely in a signal handler besides setting a flag, so
+// the sample is taken when the evaluator next checks its signals.
+//
+static void Handle_Profile_Signal(int sig)
+{
+    UNUSED(sig);
+    SET_SIGNAL(SIG_PROFILE);
+}
+
+#endif
+
+
+//
+//  Start_Profile_Timer: C
+//
+// Returns FALSE if the timer couldn't be set up on this platform.
+//
+static REBOOL Start_Profile_Timer(REBI64 usec)
+{
+#ifdef HAS_POSIX_SIGNAL
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = &Handle_Profile_Signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART; // don't make I/O calls fail with EINTR
+
+    if (sigaction(SIGPROF, &action, &Prior_Profile_Action) != 0)
+        return FALSE;
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec = cast(time_t, usec / 1000000);
+    timer.it_interval.tv_usec = cast(suseconds_t, usec % 1000000);
+    timer.it_value = timer.it_interval;
+
+    if (setitimer(ITIMER_PROF, &timer, NULL) != 0) {
+        sigaction(SIGPROF, &Prior_Profile_Action, NULL);
+        return FALSE;
+    }
+
+    TG_Profiling = TRUE;
+    return TRUE;
+#else
+    UNUSED(usec);
+    return FALSE;
+#endif
+}
+
+
+//
+//  Stop_Profile_Timer: C
+//
+static void Stop_Profile_Timer(void)
+{
+    if (NOT(TG_Profiling))
+        return;
+
+#ifdef HAS_POSIX_SIGNAL
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+
+    sigaction(SIGPROF, &Prior_Profile_Action, NULL);
+#endif
+
+    CLR_SIGNAL(SIG_PROFILE); // a sample could still be pending
+    TG_Profiling = FALSE;
+}
+
+
+//
+//  Free_Stack_Samples: C
+//
+// Like the allocation samples, the labels and files of the stacks are kept
+// alive by the GC while they exist, so they are freed before the shutdown
+// recycle.
+//
+void Free_Stack_Samples(void)
+{
+    Stop_Profile_Timer();
+
+    if (TG_Stack_Samples != NULL)
+        FREE_N(REB_STACK_SAMPLE, TG_Stack_Samples_Size, TG_Stack_Samples);
+    if (TG_Frame_Samples != NULL)
+        FREE_N(REB_FRAME_SAMPLE, TG_Frame_Samples_Size, TG_Frame_Samples);
+
+    TG_Stack_Samples = NULL;
+    TG_Stack_Samples_Size = 0;
+    TG_Stack_Samples_Used = 0;
+    TG_Frame_Samples = NULL;
+    TG_Frame_Samples_Size = 0;
+    TG_Frame_Samples_Used = 0;
+}
+
+
+//
+//  Compare_Stack_Samples: C
+//
+// Sort order for the report, most often sampled first.
+//
+static int Compare_Stack_Samples(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+
+    const REB_STACK_SAMPLE *s1 = *cast(REB_STACK_SAMPLE* const*, v1);
+    const REB_STACK_SAMPLE *s2 = *cast(REB_STACK_SAMPLE* const*, v2);
+    if (s1->count != s2->count)
+        return s1->count > s2->count ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  Fold_Stack_Sample: C
+//
+// Append a line in the "folded stacks" format of flame graph tools, e.g.
+//
+//     main (%app.r:1);process (%app.r:20);parse 12
+//
+// Frames are outermost first, with `_` for a function with no label.  The
+// line is the one the array containing the call starts on.
+//
+static void Fold_Stack_Sample(REB_MOLD *mo, const REB_STACK_SAMPLE *sample)
+{
+    REBCNT n;
+    for (n = 0; n < sample->depth; ++n) {
+        const REB_FRAME_SAMPLE *frame = &TG_Frame_Samples[sample->start + n];
+
+        if (n != 0)
+            Append_Codepoint_Raw(mo->series, ';');
+
+        if (frame->label == NULL)
+            Append_Codepoint_Raw(mo->series, '_');
+        else
+            Append_UTF8_May_Fail(
+                mo->series,
+                STR_HEAD(frame->label),
+                STR_NUM_BYTES(frame->label)
+            );
+
+        if (frame->file != NULL) {
+            Append_Unencoded(mo->series, " (%");
+            Append_UTF8_May_Fail(
+                mo->series,
+                STR_HEAD(frame->file),
+                STR_NUM_BYTES(frame->file)
+            );
+            Append_Codepoint_Raw(mo->series, ':');
+            Append_Int(mo->series, frame->line);
+            Append_Codepoint_Raw(mo->series, ')');
+        }
+    }
+
+    REBYTE buf[60];
+    buf[0] = ' ';
+    Form_Int_Len(buf + 1, sample->count, sizeof(buf) - 2);
+    Append_Unencoded(mo->series, s_cast(buf));
+    Append_Codepoint_Raw(mo->series, '\n');
+}
+
+
+//
+//  profile: native [
+//
+//  {Sample the functions on the call stack on a timer, tallied by stack.}
+//
+//      return: [block! string! <opt>]
+//          {[count [label file line ...] ...] by count, outermost first}
+//      /start
+//          "Clear any samples taken and start sampling"
+//      interval [time!]
+//          "Processor time between samples (e.g. 0:00:00.001)"
+//      /stop
+//          "Stop sampling (the samples are kept for reporting)"
+//      /folded
+//          {Report as "folded stacks" text, for flame graph tools}
+//  ]
+//
+REBNATIVE(profile)
+{
+    INCLUDE_PARAMS_OF_PROFILE;
+
+    if (REF(start)) {
+        REBI64 usec = VAL_NANO(ARG(interval)) / 1000;
+        if (usec < 1 || usec > MAX_I32)
+            fail (ARG(interval));
+
+        Free_Stack_Samples();
+        if (NOT(Grow_Stack_Samples()))
+            fail (Error_No_Memory(64 * sizeof(REB_STACK_SAMPLE)));
+
+        if (NOT(Start_Profile_Timer(usec)))
+            fail (Error_Not_Done_Raw());
+
+        return R_VOID;
+    }
+
+    if (REF(stop)) {
+        Stop_Profile_Timer();
+        return R_VOID;
+    }
+
+    // The timer may keep running while the report is made, but nothing here
+    // evaluates, so Sample_Stack() can't move the tables out from under it.
+    //
+    REBCNT num = TG_Stack_Samples_Used;
+    REB_STACK_SAMPLE **sorted = NULL;
+    if (num != 0) {
+        sorted = ALLOC_N(REB_STACK_SAMPLE*, num);
+        if (sorted == NULL)
+            fail (Error_No_Memory(num * sizeof(REB_STACK_SAMPLE*)));
+
+        REBCNT i = 0;
+        REBCNT n;
+        for (n = 0; n < TG_Stack_Samples_Size; ++n) {
+            if (TG_Stack_Samples[n].used)
+                sorted[i++] = &TG_Stack_Samples[n];
+        }
+        assert(i == num);
+
+        reb_qsort_r(
+            sorted, num, sizeof(REB_STACK_SAMPLE*), NULL, &Compare_Stack_Samples
+        );
+    }
+
+    if (REF(folded)) {
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+
+        REBCNT i;
+        for (i = 0; i < num; ++i)
+            Fold_Stack_Sample(mo, sorted[i]);
+
+        Init_String(D_OUT, Pop_Molded_String(mo));
+    }
+    else {
+        REBDSP dsp_orig = DSP;
+
+        REBCNT i;
+        for (i = 0; i < num; ++i) {
+            REB_STACK_SAMPLE *sample = sorted[i];
+
+            DS_PUSH_TRASH;
+            Init_Integer(DS_TOP, sample->count);
+
+            REBDSP dsp_stack = DSP;
+
+            REBCNT n;
+            for (n = 0; n < sample->depth; ++n) {
+                REB_FRAME_SAMPLE *frame = &TG_Frame_Samples[sample->start + n];
+
+                DS_PUSH_TRASH;
+                if (frame->label == NULL)
+                    Init_Blank(DS_TOP);
+                else
+                    Init_Word(DS_TOP, frame->label);
+
+                DS_PUSH_TRASH;
+                if (frame->file == NULL) {
+                    Init_Blank(DS_TOP);
+                    DS_PUSH_TRASH;
+                    Init_Blank(DS_TOP);
+                }
+                else {
+                    Scan_File(
+                        DS_TOP,
+                        STR_HEAD(frame->file),
+                        STR_NUM_BYTES(frame->file)
+                    );
+                    DS_PUSH_TRASH;
+                    Init_Integer(DS_TOP, frame->line);
+                }
+            }
+
+            REBARR *stack = Pop_Stack_Values(dsp_stack);
+            DS_PUSH_TRASH;
+            Init_Block(DS_TOP, stack);
+        }
+
+        Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    }
+
+    if (sorted != NULL)
+        FREE_N(REB_STACK_SAMPLE*, num, sorted);
+
+    return R_OUT;
+}
+
+
+//
+//  Find_Function_Timing: C
+//
+// Linear probing for the slot of a function, which will be an unused slot if
+// it hasn't been timed yet.  Functions the GC has freed have their timings
+// kept by label (see Retire_Function_Timings()), found with a NULL `fun`.
+//
+static REB_FUNC_TIMING *Find_Function_Timing(REBFUN *fun, REBSTR *label)
+{
+    REBUPT key = (fun != NULL) ? cast(REBUPT, fun) : cast(REBUPT, label);
+
+    REBCNT mask = TG_Func_Timings_Size - 1;
+    REBCNT n = cast(REBCNT, key >> 4) & mask;
+
+    while (TRUE) {
+        REB_FUNC_TIMING *timing = &TG_Func_Timings[n];
+        if (NOT(timing->used))
+            return timing;
+        if (timing->fun == fun && (fun != NULL || timing->label == label))
+            return timing;
+        n = (n + 1) & mask;
+    }
+}
+
+
+//
+//  Place_Function_Timing: C
+//
+// Retired timings that have the same label are merged.
+//
+static REBOOL Place_Function_Timing(const void *entry)
+{
+    const REB_FUNC_TIMING *old = cast(const REB_FUNC_TIMING*, entry);
+    if (NOT(old->used))
+        return FALSE;
+
+    REB_FUNC_TIMING *timing = Find_Function_Timing(old->fun, old->label);
+    if (NOT(timing->used)) {
+        *timing = *old;
+        return TRUE;
+    }
+
+    assert(timing->fun == NULL && timing->active == 0);
+    timing->calls += old->calls;
+    timing->self += old->self;
+    timing->total += old->total;
+    return FALSE;
+}
+
+
+//
+//  Rehash_Function_Timings: C
+//
+static REBOOL Rehash_Function_Timings(REBCNT size)
+{
+    return Rehash_Profile_Table(
+        cast(void**, &TG_Func_Timings),
+        &TG_Func_Timings_Size,
+        &TG_Func_Timings_Used,
+        sizeof(REB_FUNC_TIMING),
+        size,
+        &Place_Function_Timing
+    );
+}
+
+
+//
+//  Grow_Function_Timings: C
+//
+static REBOOL Grow_Function_Timings(void)
+{
+    return Rehash_Function_Timings(GROWN_TABLE_SIZE(TG_Func_Timings_Size));
+}
+
+
+//
+//  Retire_Function_Timings: C
+//
+// Run by the GC once marking is done.  The table doesn't keep the functions
+// it has timed alive, or every closure made while timing would be kept for
+// the rest of the session.  Instead, the timings of functions that weren't
+// marked are kept by their label from now on, and merged with those of any
+// other freed function of that label.  (If there isn't memory to rehash the
+// table for that now, they are merged when it next grows.)
+//
+void Retire_Function_Timings(void)
+{
+    REBCNT retired = 0;
+
+    REBCNT n;
+    for (n = 0; n < TG_Func_Timings_Size; ++n) {
+        REB_FUNC_TIMING *timing = &TG_Func_Timings[n];
+        if (NOT(timing->used) || timing->fun == NULL)
+            continue;
+
+        REBSER *paramlist = SER(FUNC_PARAMLIST(timing->fun));
+        if (paramlist->header.bits & NODE_FLAG_MARKED)
+            continue;
+
+        assert(timing->active == 0); // a call in progress keeps it alive
+        timing->fun = NULL;
+        ++retired;
+    }
+
+    if (retired != 0)
+        Rehash_Function_Timings(TG_Func_Timings_Size);
+}
+
+
+//
+//  Grow_Timing_Calls: C
+//
+// Double the room for timed calls in progress.  Returns FALSE if memory
+// wasn't available.
+//
+static REBOOL Grow_Timing_Calls(void)
+{
+    REBCNT old_size = TG_Timing_Calls_Size;
+    REBCNT size = (old_size == 0) ? 64 : old_size * 2;
+
+    REB_TIMING_CALL *calls = ALLOC_N(REB_TIMING_CALL, size);
+    if (calls == NULL)
+        return FALSE;
+
+    if (TG_Timing_Calls != NULL) {
+        memcpy(calls, TG_Timing_Calls, sizeof(REB_TIMING_CALL) * old_size);
+        FREE_N(REB_TIMING_CALL, old_size, TG_Timing_Calls);
+    }
+
+    TG_Timing_Calls = calls;
+    TG_Timing_Calls_Size = size;
+    return TRUE;
+}
+
+
+//
+//  Apply_Core_Timed: C
+//
+// This is the function which is swapped in for PG_Apply when functions are
+// being timed, running the hook it displaced (PG_Timed_Apply) to do the work.
+// It runs once per phase of a call (e.g. an ADAPT runs its prelude and then
+// the adaptee), so the call is only counted in the first phase, though the
+// time of all of them goes to the function that was called.
+//
+// The table may grow during the call, so it is looked up again after.
+//
+REB_R Apply_Core_Timed(REBFRM * const f)
+{
+    if (TG_Timing_Depth == TG_Timing_Calls_Size)
+        if (NOT(Grow_Timing_Calls()))
+            return (*PG_Timed_Apply)(f); // don't time it rather than fail
+
+    if (TG_Func_Timings_Used * 2 >= TG_Func_Timings_Size)
+        if (NOT(Grow_Function_Timings()))
+            return (*PG_Timed_Apply)(f);
+
+    REBFUN *fun = f->original;
+    REB_FUNC_TIMING *timing = Find_Function_Timing(fun, NULL);
+    if (NOT(timing->used)) {
+        timing->fun = fun;
+        timing->label = FRM_LABEL(f);
+        timing->used = TRUE;
+        ++TG_Func_Timings_Used;
+    }
+    if (f->phase == f->original)
+        ++timing->calls;
+
+    REBCNT depth = TG_Timing_Depth++;
+    REB_TIMING_CALL *call = &TG_Timing_Calls[depth];
+    call->fun = fun;
+    call->children = 0;
+    call->outermost = LOGICAL(timing->active == 0);
+    ++timing->active;
+    call->start = OS_DELTA_TIME(0, 0);
+
+    REB_R r = (*PG_Timed_Apply)(f);
+
+    call = &TG_Timing_Calls[depth];
+    REBI64 elapsed = OS_DELTA_TIME(call->start, 0);
+
+    assert(TG_Timing_Depth == depth + 1);
+    TG_Timing_Depth = depth;
+
+    if (depth < TG_Timing_Base) {
+        TG_Timing_Base = depth; // began before the table was cleared
+        return r;
+    }
+
+    timing = Find_Function_Timing(fun, NULL);
+    assert(timing->fun == fun && timing->active != 0);
+    --timing->active;
+    timing->self += elapsed - call->children;
+    if (call->outermost)
+        timing->total += elapsed;
+
+    if (depth != 0)
+        TG_Timing_Calls[depth - 1].children += elapsed;
+
+    return r;
+}
+
+
+//
+//  Drop_Timing_Calls: C
+//
+// A fail() unwinds the C stack past calls to Apply_Core_Timed() without them
+// returning.  The trap that catches it drops their records to where they
+// were when it was pushed.  (The time they took is counted as the catching
+// call's own.)
+//
+void Drop_Timing_Calls(REBCNT depth)
+{
+    assert(TG_Timing_Depth > depth);
+
+    while (TG_Timing_Depth != depth) {
+        --TG_Timing_Depth;
+        if (TG_Timing_Depth < TG_Timing_Base)
+            continue;
+
+        REB_FUNC_TIMING *timing = Find_Function_Timing(
+            TG_Timing_Calls[TG_Timing_Depth].fun, NULL
+        );
+        assert(timing->active != 0);
+        --timing->active;
+    }
+
+    if (TG_Timing_Base > depth)
+        TG_Timing_Base = depth;
+}
+
+
+//
+//  Clear_Function_Timings: C
+//
+// Calls in progress are left on the stack, but won't be counted when they
+// return (they may have started long before).
+//
+static void Clear_Function_Timings(void)
+{
+    if (TG_Func_Timings != NULL)
+        FREE_N(REB_FUNC_TIMING, TG_Func_Timings_Size, TG_Func_Timings);
+
+    TG_Func_Timings = NULL;
+    TG_Func_Timings_Size = 0;
+    TG_Func_Timings_Used = 0;
+    TG_Timing_Base = TG_Timing_Depth;
+}
+
+
+//
+//  Free_Function_Timings: C
+//
+// The labels in the table are kept alive by the GC while it exists, so it is
+// freed before the shutdown recycle.
+//
+void Free_Function_Timings(void)
+{
+    if (PG_Apply == &Apply_Core_Timed)
+        PG_Apply = PG_Timed_Apply;
+
+    Clear_Function_Timings();
+
+    if (TG_Timing_Calls != NULL)
+        FREE_N(REB_TIMING_CALL, TG_Timing_Calls_Size, TG_Timing_Calls);
+
+    TG_Timing_Calls = NULL;
+    TG_Timing_Calls_Size = 0;
+    TG_Timing_Depth = 0;
+    TG_Timing_Base = 0;
+}
+
+
+//
+//  Compare_Function_Timings: C
+//
+// Sort order for the report, most self time first.
+//
+static int Compare_Function_Timings(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+
+    const REB_FUNC_TIMING *t1 = *cast(REB_FUNC_TIMING* const*, v1);
+    const REB_FUNC_TIMING *t2 = *cast(REB_FUNC_TIMING* const*, v2);
+    if (t1->self != t2->self)
+        return t1->self > t2->self ? -1 : 1;
+    if (t1->calls != t2->calls)
+        return t1->calls > t2->calls ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  profile-functions: native [
+//
+//  {Time every function call, tallied by the function that was called.}
+//
+//      return: [block! <opt>]
+//          {[label calls self-time total-time ...] by self time}
+//      /on
+//          "Clear any timings taken and start timing calls"
+//      /off
+//          "Stop timing calls (the timings are kept for reporting)"
+//  ]
+//
+REBNATIVE(profile_functions)
+{
+    INCLUDE_PARAMS_OF_PROFILE_FUNCTIONS;
+
+    if (REF(on)) {
+        Clear_Function_Timings();
+        if (NOT(Grow_Function_Timings()))
+            fail (Error_No_Memory(64 * sizeof(REB_FUNC_TIMING)));
+
+        if (PG_Apply != &Apply_Core_Timed) {
+            PG_Timed_Apply = PG_Apply;
+            PG_Apply = &Apply_Core_Timed;
+        }
+        return R_VOID;
+    }
+
+    if (REF(off)) {
+        if (PG_Apply == &Apply_Core_Timed)
+            PG_Apply = PG_Timed_Apply;
+        return R_VOID;
+    }
+
+    // Timings of functions that haven't returned yet don't have their time
+    // counted, but their calls are.  (The only one running if this was
+    // called at the top level is PROFILE-FUNCTIONS itself.)
+
+    REBCNT num = TG_Func_Timings_Used;
+    REB_FUNC_TIMING **sorted = NULL;
+    if (num != 0) {
+        sorted = ALLOC_N(REB_FUNC_TIMING*, num);
+        if (sorted == NULL)
+            fail (Error_No_Memory(num * sizeof(REB_FUNC_TIMING*)));
+
+        REBCNT i = 0;
+        REBCNT n;
+        for (n = 0; n < TG_Func_Timings_Size; ++n) {
+            if (TG_Func_Timings[n].used)
+                sorted[i++] = &TG_Func_Timings[n];
+        }
+        assert(i == num);
+
+        reb_qsort_r(
+            sorted, num, sizeof(REB_FUNC_TIMING*), NULL,
+            &Compare_Function_Timings
+        );
+    }
+
+    REBDSP dsp_orig = DSP;
+
+    REBCNT i;
+    for (i = 0; i < num; ++i) {
+        REB_FUNC_TIMING *timing = sorted[i];
+
+        DS_PUSH_TRASH;
+        if (timing->label == NULL)
+            Init_Blank(DS_TOP);
+        else
+            Init_Word(DS_TOP, timing->label);
+
+        DS_PUSH_TRASH;
+        Init_Integer(DS_TOP, timing->calls);
+
+        DS_PUSH_TRASH;
+        Init_Time_Nanoseconds(DS_TOP, timing->self * 1000);
+
+        DS_PUSH_TRASH;
+        Init_Time_Nanoseconds(DS_TOP, timing->total * 1000);
+    }
+
+    if (sorted != NULL)
+        FREE_N(REB_FUNC_TIMING*, num, sorted);
+
+    Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    return R_OUT;
+}
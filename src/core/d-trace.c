@@ -412,9 +412,16 @@ REBNATIVE(trace)
     else
         Trace_Level = Int32(mode);
 
+    // If PROFILE-FUNCTIONS is timing calls its hook stays in PG_Apply, and
+    // the tracing hook is swapped in underneath it instead.
+    //
+    REBAPF *apply = (PG_Apply == &Apply_Core_Timed)
+        ? &PG_Timed_Apply
+        : &PG_Apply;
+
     if (Trace_Level) {
         PG_Do = &Do_Core_Traced;
-        PG_Apply = &Apply_Core_Traced;
+        *apply = &Apply_Core_Traced;
 
         if (REF(function))
             SET_FLAG(Trace_Flags, 1);
@@ -422,7 +429,7 @@ REBNATIVE(trace)
     }
     else {
         PG_Do = &Do_Core;
-        PG_Apply = &Apply_Core;
+        *apply = &Apply_Core;
     }
 
     return R_VOID;
@@ -471,6 +471,50 @@ REBVAL *Alloc_Tail_Array(REBARR *a)
 }
 
 
+//
+//  Get_Hash_Index: C
+//
+// Get the hash index of an array with ARRAY_INFO_HASHED, for lookups with
+// Find_Key_Indexed().  Every value is in it under its position (1-based),
+// except for values that can't be hashed and series whose hash can change
+// without this array being modified: arrays (hashed by their length) and
+// strings and binaries (hashed by their content).
+//
+// The index is built on the first use after it was invalidated, and values
+// that have been appended since the last use are added to it.
+//
+REBSER *Get_Hash_Index(REBARR *a)
+{
+    assert(GET_SER_INFO(a, ARRAY_INFO_HASHED));
+
+    REBSER *hashlist = SER(a)->link.hashlist;
+    REBCNT len = ARR_LEN(a);
+
+    if (hashlist == NULL || SER(a)->misc.hashed > len) {
+        hashlist = Make_Hash_Sequence(len);
+        MANAGE_SERIES(hashlist);
+        SER(a)->link.hashlist = hashlist;
+        SER(a)->misc.hashed = 0;
+    }
+
+    REBCNT n = SER(a)->misc.hashed;
+    if (n == len)
+        return hashlist;
+
+    while (len * 2 > SER_LEN(hashlist))
+        Expand_Hash(hashlist);
+
+    for (; n < len; ++n) {
+        const RELVAL *v = ARR_AT(a, n);
+        if (NOT(ANY_ARRAY(v) || ANY_BINSTR(v)) && Is_Value_Hashable(v))
+            Insert_Key_Hashed(hashlist, v, n + 1);
+    }
+    SER(a)->misc.hashed = len;
+
+    return hashlist;
+}
+
+
 //
 //  Uncolor_Array: C
 //
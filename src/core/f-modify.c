@@ -62,6 +62,9 @@ REBCNT Modify_Array(
 
     if (action == SYM_APPEND || dst_idx > tail) dst_idx = tail;
 
+    if (action == SYM_CHANGE && dst_idx < tail)
+        Invalidate_Array_Indexes(SER(dst_arr)); // values will be overwritten
+
     // Check /PART, compute LEN:
     if (NOT(flags & AM_ONLY) && ANY_ARRAY(src_val)) {
         // Adjust length of insertion if changing /PART:
@@ -0,0 +1,400 @@
+//
+//  File: %f-msort.c
+//  Summary: "Stable merge sort, with the same comparators as reb_qsort_r()"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2017 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// reb_qsort_r() does not keep elements that compare equal in the order they
+// were in, which SORT/STABLE promises.  This is a bottom-up merge sort that
+// takes the same comparator and thunk, so it can be swapped in for it.
+//
+// Rather than allocate, it is given a buffer the size of the data to use.
+// Runs of a few elements are insertion sorted into that buffer, and then each
+// pass merges from one of the two into the other, with the sorted result
+// copied back to the data at the end if it wound up in the buffer.
+//
+// A comparator that can evaluate might fail partway through a pass, leaving
+// the half being merged into with some elements twice and others not at all.
+// So for those, each pass merges from the data into the buffer and is then
+// copied back: the data always holds each element exactly once (just not all
+// in order yet), which is what the caller will be left with.
+//
+// In builds made with PARALLEL_SORT, Parallel_Merge_Sort() splits a large
+// sort into slices that threads merge sort at the same time, and then merges
+// the sorted slices pairwise (also in parallel) until one is left.  Nothing
+// else in the interpreter is thread-safe, so this is only for comparators
+// that can't evaluate, allocate or fail: it is up to the caller to decide.
+//
+
+#include "sys-core.h"
+
+#ifdef PARALLEL_SORT
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+// Length of the runs that are insertion sorted before merging starts.
+//
+#define MSORT_RUN 8
+
+
+//
+//  Insertion_Sort_Into: C
+//
+// Sort `num` elements of `src` into `dest`, which must not overlap it.
+//
+static void Insertion_Sort_Into(
+    REBYTE *dest,
+    const REBYTE *src,
+    REBCNT num,
+    REBCNT size,
+    void *thunk,
+    cmp_t *cmp
+){
+    REBCNT n;
+    for (n = 0; n < num; ++n) {
+        const REBYTE *elem = src + n * size;
+
+        // Stop at an element that isn't greater, so equal ones stay in order.
+        //
+        REBCNT pos = n;
+        while (pos > 0 && cmp(thunk, dest + (pos - 1) * size, elem) > 0)
+            --pos;
+
+        memmove(dest + (pos + 1) * size, dest + pos * size, (n - pos) * size);
+        memcpy(dest + pos * size, elem, size);
+    }
+}
+
+
+//
+//  Merge_Runs: C
+//
+// Merge the sorted runs src[0..mid) and src[mid..num) into dest.  On a tie
+// the element from the left run goes first, which is what makes it stable.
+//
+static void Merge_Runs(
+    REBYTE *dest,
+    const REBYTE *src,
+    REBCNT mid,
+    REBCNT num,
+    REBCNT size,
+    void *thunk,
+    cmp_t *cmp
+){
+    const REBYTE *left = src;
+    const REBYTE *left_end = src + mid * size;
+    const REBYTE *right = left_end;
+    const REBYTE *right_end = src + num * size;
+
+    // If the runs are already in order, there's nothing to interleave.
+    //
+    if (mid != 0 && mid != num && cmp(thunk, right - size, right) <= 0) {
+        memcpy(dest, src, num * size);
+        return;
+    }
+
+    while (left != left_end && right != right_end) {
+        if (cmp(thunk, left, right) <= 0) {
+            memcpy(dest, left, size);
+            left += size;
+        }
+        else {
+            memcpy(dest, right, size);
+            right += size;
+        }
+        dest += size;
+    }
+
+    memcpy(dest, left, left_end - left);
+    dest += left_end - left;
+    memcpy(dest, right, right_end - right);
+}
+
+
+//
+//  Merge_Sort: C
+//
+// Sort `num` elements of `size` bytes at `base` stably, using `temp` (which
+// must have room for `num * size` bytes) as the other half of the merges.
+// The comparator is called as `cmp(thunk, a, b)` like reb_qsort_r()'s, and
+// `can_fail` says whether it might fail out of the sort.
+//
+void Merge_Sort(
+    void *base,
+    void *temp,
+    REBCNT num,
+    REBCNT size,
+    void *thunk,
+    cmp_t *cmp,
+    REBOOL can_fail
+){
+    if (num < 2)
+        return;
+
+    REBYTE *data = cast(REBYTE*, base);
+    REBYTE *buf = cast(REBYTE*, temp);
+
+    REBCNT start;
+    for (start = 0; start < num; start += MSORT_RUN) {
+        REBCNT run = MIN(MSORT_RUN, num - start);
+        Insertion_Sort_Into(
+            buf + start * size, data + start * size, run, size, thunk, cmp
+        );
+    }
+
+    REBYTE *src = buf;
+    REBYTE *dest = data;
+    if (can_fail) {
+        memcpy(data, buf, num * size);
+        src = data;
+        dest = buf;
+    }
+
+    REBCNT width;
+    for (width = MSORT_RUN; width < num; width *= 2) {
+        for (start = 0; start < num; start += 2 * width) {
+            REBCNT mid = MIN(width, num - start);
+            REBCNT len = MIN(2 * width, num - start);
+            Merge_Runs(
+                dest + start * size, src + start * size, mid, len,
+                size, thunk, cmp
+            );
+        }
+
+        if (can_fail)
+            memcpy(data, buf, num * size);
+        else {
+            REBYTE *swap = src;
+            src = dest;
+            dest = swap;
+        }
+    }
+
+    if (src != data)
+        memcpy(data, src, num * size);
+}
+
+
+// Sorts smaller than this aren't split across threads, as starting them
+// would take a good part of the time that could be saved.
+//
+#define MIN_PARALLEL_SORT 50000
+
+// Limit on threads, whatever system/options/sort-threads says.
+//
+#define MAX_SORT_THREADS 64
+
+
+//
+//  Sort_Threads: C
+//
+// How many threads a sort of `num` elements should be split across, which is
+// 1 if it shouldn't be (or if this build can't).
+//
+REBCNT Sort_Threads(REBCNT num)
+{
+#ifdef PARALLEL_SORT
+    if (num < MIN_PARALLEL_SORT)
+        return 1;
+
+    REBVAL *option = Get_System(SYS_OPTIONS, OPTIONS_SORT_THREADS);
+
+    REBI64 threads;
+    if (IS_INTEGER(option))
+        threads = VAL_INT64(option);
+    else
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (threads < 1)
+        return 1;
+    if (threads > MAX_SORT_THREADS)
+        threads = MAX_SORT_THREADS;
+    return cast(REBCNT, threads);
+#else
+    UNUSED(num);
+    return 1;
+#endif
+}
+
+
+#ifdef PARALLEL_SORT
+
+// One slice of the work, for a thread (or the thread that started the sort).
+// A slice is either sorted by Merge_Sort() (`mid` is 0), or its two sorted
+// halves are merged (`mid` is where the second half starts).
+//
+struct msort_job {
+    REBYTE *dest;
+    REBYTE *src;
+    REBCNT mid;
+    REBCNT num;
+    REBCNT size;
+    void *thunk;
+    cmp_t *cmp;
+    pthread_t thread;
+    REBOOL started;
+};
+
+
+//
+//  Run_Sort_Job: C
+//
+static void *Run_Sort_Job(void *arg)
+{
+    struct msort_job *job = cast(struct msort_job*, arg);
+    if (job->mid == 0)
+        Merge_Sort(
+            job->dest, job->src, job->num, job->size,
+            job->thunk, job->cmp, FALSE
+        );
+    else
+        Merge_Runs(
+            job->dest, job->src, job->mid, job->num,
+            job->size, job->thunk, job->cmp
+        );
+    return NULL;
+}
+
+
+//
+//  Run_Sort_Jobs: C
+//
+// Give all but the first job a thread, do the first one on this thread, and
+// wait for the rest.  If a thread can't be started, its job is done here.
+//
+static void Run_Sort_Jobs(struct msort_job *jobs, REBCNT num_jobs)
+{
+    REBCNT n;
+    for (n = 1; n < num_jobs; ++n)
+        jobs[n].started = LOGICAL(
+            0 == pthread_create(&jobs[n].thread, NULL, &Run_Sort_Job, &jobs[n])
+        );
+
+    Run_Sort_Job(&jobs[0]);
+
+    for (n = 1; n < num_jobs; ++n) {
+        if (jobs[n].started)
+            pthread_join(jobs[n].thread, NULL);
+        else
+            Run_Sort_Job(&jobs[n]);
+    }
+}
+
+#endif
+
+
+//
+//  Parallel_Merge_Sort: C
+//
+// Sort like Merge_Sort(), but split across `threads` threads (as given by
+// Sort_Threads()).  The result is the same, so it is stable.  A comparator
+// that `can_fail` can't be given more than one thread.
+//
+void Parallel_Merge_Sort(
+    void *base,
+    void *temp,
+    REBCNT num,
+    REBCNT size,
+    void *thunk,
+    cmp_t *cmp,
+    REBOOL can_fail,
+    REBCNT threads
+){
+#ifdef PARALLEL_SORT
+    if (threads < 2 || num < threads * 2) {
+        Merge_Sort(base, temp, num, size, thunk, cmp, can_fail);
+        return;
+    }
+
+    assert(NOT(can_fail));
+
+    REBYTE *data = cast(REBYTE*, base);
+    REBYTE *buf = cast(REBYTE*, temp);
+
+    struct msort_job jobs[MAX_SORT_THREADS];
+    REBCNT bounds[MAX_SORT_THREADS + 1]; // where each sorted run starts
+
+    REBCNT runs = threads;
+    REBCNT n;
+    for (n = 0; n <= runs; ++n)
+        bounds[n] = cast(REBCNT, (cast(REBU64, num) * n) / runs);
+
+    for (n = 0; n < runs; ++n) {
+        struct msort_job *job = &jobs[n];
+        job->dest = data + bounds[n] * size;
+        job->src = buf + bounds[n] * size; // used as the merge buffer
+        job->mid = 0;
+        job->num = bounds[n + 1] - bounds[n];
+        job->size = size;
+        job->thunk = thunk;
+        job->cmp = cmp;
+    }
+    Run_Sort_Jobs(jobs, runs);
+
+    // The sorted runs are in `data`.  Merge them in pairs into the other
+    // buffer, back and forth, until there is one run.  An odd one out at the
+    // end is just copied across.
+    //
+    REBYTE *src = data;
+    REBYTE *dest = buf;
+
+    while (runs > 1) {
+        REBCNT pairs = runs / 2;
+        for (n = 0; n < pairs; ++n) {
+            struct msort_job *job = &jobs[n];
+            REBCNT start = bounds[2 * n];
+            job->dest = dest + start * size;
+            job->src = src + start * size;
+            job->mid = bounds[2 * n + 1] - start;
+            job->num = bounds[2 * n + 2] - start;
+        }
+        Run_Sort_Jobs(jobs, pairs);
+
+        if (runs % 2 != 0) {
+            REBCNT start = bounds[runs - 1];
+            memcpy(
+                dest + start * size,
+                src + start * size,
+                (num - start) * size
+            );
+        }
+
+        for (n = 0; n <= pairs; ++n)
+            bounds[n] = bounds[2 * n < runs ? 2 * n : runs];
+        bounds[(runs + 1) / 2] = num;
+        runs = (runs + 1) / 2;
+
+        REBYTE *swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    if (src != data)
+        memcpy(data, src, num * size);
+#else
+    UNUSED(threads);
+    Merge_Sort(base, temp, num, size, thunk, cmp, can_fail);
+#endif
+}
@@ -45,6 +45,14 @@
 
 #include "sys-core.h"
 
+// Where the compiler is targeting SSE2 (which every x86-64 CPU has), some
+// runs of bytes are skipped 16 at a time.  See Skip_Lex_Space() and others.
+//
+#if defined(__SSE2__) && defined(__GNUC__)
+    #include <emmintrin.h>
+    #define SCAN_SSE2
+#endif
+
 
 //
 // Maps each character to its lexical attributes, using
@@ -293,6 +301,137 @@ const REBYTE Lower_Case[256] =
 #endif
 
 
+// The scanner is fed UTF-8 that is terminated by a null byte, and is driven
+// by the Lex_Map classification of one byte at a time.  For the long runs of
+// bytes it passes over without much thought--indentation, comments, and the
+// plain text inside strings--the routines below find where the run stops 16
+// bytes at a time.  They stop on exactly the byte the byte-at-a-time loop
+// would have, so the token logic is unchanged.
+//
+// The input is only read in chunks up to the scan state's `limit`, which is
+// where the caller says the data ends, and the rest is done a byte at a time
+// as before.  (Callers like Scan_Any_Word() give a limit but rely on the
+// scanner stopping at a delimiter before it, so it's not assumed to be 0.)
+//
+// Bytes of 0x80 and up always stop a run of plain text in a string.  So the
+// ASCII in strings is accepted as valid UTF-8 16 bytes at a time, and only
+// encoded codepoints go through Back_Scan_UTF8_Char() to be checked.
+//
+#ifdef SCAN_SSE2
+    #define SCAN_CHUNK 16
+
+    inline static int Chunk_Mask(__m128i matches) {
+        return _mm_movemask_epi8(matches);
+    }
+
+    inline static __m128i Load_Chunk(const REBYTE *cp) {
+        return _mm_loadu_si128(cast(const __m128i*, cp));
+    }
+
+    inline static __m128i Match_Byte(__m128i chunk, REBYTE b) {
+        return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(cast(char, b)));
+    }
+#endif
+
+
+//
+//  Skip_Lex_Space: C
+//
+// Skip the bytes that IS_LEX_SPACE() starting at `cp`.  Indentation is mostly
+// made of the space character, so runs of that are skipped in chunks.
+//
+static const REBYTE *Skip_Lex_Space(const REBYTE *cp, const REBYTE *limit)
+{
+#ifdef SCAN_SSE2
+    while (cp[0] == ' ' && limit - cp >= SCAN_CHUNK) {
+        int mask = Chunk_Mask(Match_Byte(Load_Chunk(cp), ' '));
+        if (mask != 0xFFFF) {
+            cp += __builtin_ctz(~mask); // first byte that's not a space
+            break;
+        }
+        cp += SCAN_CHUNK;
+    }
+#else
+    UNUSED(limit);
+#endif
+
+    while (IS_LEX_SPACE(*cp))
+        ++cp;
+    return cp;
+}
+
+
+//
+//  Skip_To_Line_End: C
+//
+// Skip to the first CR, LF, or null byte at or after `cp`, e.g. the end of a
+// comment.
+//
+static const REBYTE *Skip_To_Line_End(const REBYTE *cp, const REBYTE *limit)
+{
+#ifdef SCAN_SSE2
+    while (limit - cp >= SCAN_CHUNK) {
+        __m128i chunk = Load_Chunk(cp);
+        int mask = Chunk_Mask(_mm_or_si128(
+            _mm_or_si128(Match_Byte(chunk, CR), Match_Byte(chunk, LF)),
+            Match_Byte(chunk, '\0')
+        ));
+        if (mask != 0)
+            return cp + __builtin_ctz(mask);
+        cp += SCAN_CHUNK;
+    }
+#else
+    UNUSED(limit);
+#endif
+
+    while (NOT(ANY_CR_LF_END(*cp)))
+        ++cp;
+    return cp;
+}
+
+
+//
+//  Skip_Plain_Quoted: C
+//
+// Skip the bytes at or after `cp` that Scan_Quote_Push_Mold() would copy into
+// the mold buffer as they are: ASCII other than the null byte, CR, LF, and
+// the `"` `{` `}` `^` that may end a string, nest, or escape.
+//
+static const REBYTE *Skip_Plain_Quoted(const REBYTE *cp, const REBYTE *limit)
+{
+#ifdef SCAN_SSE2
+    while (limit - cp >= SCAN_CHUNK) {
+        __m128i chunk = Load_Chunk(cp);
+        __m128i stops = _mm_or_si128(
+            _mm_or_si128(
+                _mm_or_si128(Match_Byte(chunk, '"'), Match_Byte(chunk, '^')),
+                _mm_or_si128(Match_Byte(chunk, '{'), Match_Byte(chunk, '}'))
+            ),
+            _mm_or_si128(
+                _mm_or_si128(Match_Byte(chunk, CR), Match_Byte(chunk, LF)),
+                Match_Byte(chunk, '\0')
+            )
+        );
+        int mask = Chunk_Mask(stops) | Chunk_Mask(chunk); // chunk: >= 0x80
+        if (mask != 0)
+            return cp + __builtin_ctz(mask);
+        cp += SCAN_CHUNK;
+    }
+#else
+    UNUSED(limit);
+#endif
+
+    while (
+        *cp != '\0' && *cp < 0x80
+        && *cp != '"' && *cp != '^' && *cp != '{' && *cp != '}'
+        && *cp != CR && *cp != LF
+    ){
+        ++cp;
+    }
+    return cp;
+}
+
+
 //
 //  Scan_UTF8_Char_Escapable: C
 //
@@ -417,6 +556,24 @@ static const REBYTE *Scan_Quote_Push_Mold(
     REBINT nest = 0;
     REBCNT lines = 0;
     while (*src != term || nest > 0) {
+        //
+        // Text that needs no escaping or decoding is widened into the buffer
+        // a run at a time.
+        //
+        const REBYTE *plain = Skip_Plain_Quoted(src, ss->limit);
+        if (plain != src) {
+            REBCNT run = plain - src;
+            if (SER_LEN(mo->series) + run + 1 >= SER_REST(mo->series))
+                Extend_Series(mo->series, run + 1); // incl term
+
+            REBUNI *up = UNI_TAIL(mo->series);
+            for (; src != plain; ++src, ++up)
+                *up = *src;
+
+            SET_SERIES_LEN(mo->series, SER_LEN(mo->series) + run);
+            continue;
+        }
+
         REBUNI chr = *src;
 
         switch (chr) {
@@ -756,7 +913,7 @@ static REBCNT Prescan_Token(SCAN_STATE *ss)
     REBCNT flags = 0;
 
     // Skip whitespace (if any) and update the ss
-    while (IS_LEX_SPACE(*cp)) cp++;
+    cp = Skip_Lex_Space(cp, ss->limit);
     ss->begin = cp;
 
     while (TRUE) {
@@ -903,8 +1060,7 @@ static void Locate_Token_May_Push_Mold(
             panic ("Prescan_Token did not skip whitespace");
 
         case LEX_DELIMIT_SEMICOLON:     /* ; begin comment */
-            while (NOT(ANY_CR_LF_END(*cp)))
-                ++cp;
+            cp = Skip_To_Line_End(cp, ss->limit);
             if (*cp == '\0')
                 --cp;             /* avoid passing EOF  */
             if (*cp == LF) goto line_feed;
@@ -1617,6 +1773,15 @@ static REBINT Scan_Head(SCAN_STATE *ss)
 static REBARR *Scan_Full_Array(SCAN_STATE *ss, REBYTE mode_char);
 static REBARR *Scan_Child_Array(SCAN_STATE *ss, REBYTE mode_char);
 
+// The values scanned for an array are gathered on the data stack, which has
+// a limit on its size (STACK_LIMIT).  Data files can have more values than
+// that in one array, e.g. at the top level with a record on each line.  So
+// once this many are on the stack, Scan_Array() moves them into the array it
+// is building.
+//
+#define MAX_SCAN_GATHER 4096
+
+
 //
 //  Scan_Array: C
 //
@@ -1667,6 +1832,13 @@ static REBARR *Scan_Array(
     REB_MOLD mo;
     CLEARS(&mo);
 
+    // Values moved off the data stack, see MAX_SCAN_GATHER.  Not done when
+    // relaxed, but it is read after the trap is jumped to, so it's volatile
+    // to be sure it isn't left in a register that longjmp clobbered.
+    //
+    REBARR * volatile gathered;
+    gathered = NULL;
+
     if (just_once)
         CLR_FLAG(ss->opts, SCAN_NEXT); // no deeper
 
@@ -2099,6 +2271,22 @@ static REBARR *Scan_Array(
             SET_VAL_FLAG(DS_TOP, VALUE_FLAG_LINE);
         }
 
+        if (
+            DSP - dsp_orig >= MAX_SCAN_GATHER
+            && NOT(GET_FLAG(ss->opts, SCAN_RELAX))
+        ){
+            if (gathered == NULL) {
+                gathered = Pop_Stack_Values(dsp_orig);
+                PUSH_GUARD_ARRAY_CONTENTS(gathered);
+            }
+            else {
+                Append_Values_Len(
+                    gathered, DS_AT(dsp_orig + 1), DSP - dsp_orig
+                );
+                DS_DROP_TO(dsp_orig);
+            }
+        }
+
         // Check for end of path:
         if (mode_char == '/') {
             if (*ep == '/') {
@@ -2130,7 +2318,19 @@ array_done:
 array_done_relax:
     Drop_Mold_If_Pushed(&mo);
 
-    REBARR *result = Pop_Stack_Values(dsp_orig);
+    REBARR *result;
+    if (gathered == NULL)
+        result = Pop_Stack_Values(dsp_orig);
+    else {
+        if (DSP != dsp_orig) {
+            Append_Values_Len(
+                gathered, DS_AT(dsp_orig + 1), DSP - dsp_orig
+            );
+            DS_DROP_TO(dsp_orig);
+        }
+        DROP_GUARD_ARRAY_CONTENTS(gathered);
+        result = gathered;
+    }
 
     // All scanned code is expected to be managed by the GC (because walking
     // the tree after constructing it to add the "manage GC" bit would be
@@ -2294,7 +2494,9 @@ void Shutdown_Scanner(void)
 //      /file
 //          file-name [file! url!]
 //      /line
-//          line-number [integer!]
+//          {Line number of the start of source, or a word holding it (which
+//          is set to the line number the scan stopped on)}
+//          line-number [integer! any-word!]
 //  ]
 //
 REBNATIVE(transcode)
@@ -2330,9 +2532,16 @@ REBNATIVE(transcode)
 
     REBUPT start_line = 1;
     if (REF(line)) {
-        start_line = VAL_INT32(ARG(line_number));
-        if (start_line <= 0)
-            fail (ARG(line_number));
+        //
+        // A word lets a caller scanning a source a piece at a time (e.g. with
+        // /NEXT) carry on counting lines from where the last piece stopped.
+        //
+        const REBVAL *line_number = ARG(line_number);
+        if (ANY_WORD(line_number))
+            line_number = Get_Opt_Var_May_Fail(line_number, SPECIFIED);
+        if (NOT(IS_INTEGER(line_number)) || VAL_INT64(line_number) <= 0)
+            fail (Error_Invalid_Arg_Core(line_number, SPECIFIED));
+        start_line = VAL_INT32(line_number);
     }
     else
         start_line = 1;
@@ -2369,6 +2578,162 @@ REBNATIVE(transcode)
     VAL_INDEX(ARG(source)) = ss.end - VAL_BIN(ARG(source));
     Append_Value(VAL_ARRAY(D_OUT), ARG(source));
 
+    if (REF(line) && ANY_WORD(ARG(line_number)))
+        Init_Integer(Sink_Var_May_Fail(ARG(line_number), SPECIFIED), ss.line);
+
+    return R_OUT;
+}
+
+
+//
+//  Skip_String_Source: C
+//
+// Skip a "string" or {string} whose opening character is at `cp`, giving
+// the position after its end.  Like Scan_Quote_Push_Mold() a "string" ends
+// at a line break, and then the line break is where it stops.  It stops at
+// `limit` if the string isn't finished by then.
+//
+static const REBYTE *Skip_String_Source(const REBYTE *cp, const REBYTE *limit)
+{
+    const REBOOL braces = LOGICAL(*cp == '{');
+    REBCNT nest = 0;
+
+    ++cp;
+    while (TRUE) {
+        cp = Skip_Plain_Quoted(cp, limit);
+        if (cp >= limit)
+            return limit;
+
+        switch (*cp) {
+        case '^':
+            if (limit - cp < 2)
+                return limit;
+            cp += 2; // whatever is escaped, it can't end the string
+            break;
+
+        case '"':
+            ++cp;
+            if (NOT(braces))
+                return cp;
+            break;
+
+        case '{':
+            ++cp;
+            if (braces)
+                ++nest;
+            break;
+
+        case '}':
+            ++cp;
+            if (braces) {
+                if (nest == 0)
+                    return cp;
+                --nest;
+            }
+            break;
+
+        case LF:
+            if (NOT(braces))
+                return cp;
+            ++cp;
+            break;
+
+        default: // CR, an embedded null, or a byte of an encoded codepoint
+            ++cp;
+            break;
+        }
+    }
+}
+
+
+//
+//  Find_Top_Level_Break: C
+//
+// A pre-pass for splitting source that starts between top-level values into
+// pieces that can be scanned separately.  Returns the position after the last
+// line feed before `limit` that isn't in a block, group, string or comment,
+// or NULL if there isn't one.
+//
+// Only enough is looked at to see where values end, nothing is checked.  Tags
+// aren't tracked, since telling a tag from words like `<` or `<=` takes the
+// whole scanner: brackets or quotes in a tag can make a break be missed.
+//
+static const REBYTE *Find_Top_Level_Break(
+    const REBYTE *cp,
+    const REBYTE *limit
+) {
+    const REBYTE *found = NULL;
+    REBCNT depth = 0; // of blocks and groups
+
+    while (cp < limit) {
+        switch (*cp) {
+        case LF:
+            ++cp;
+            if (depth == 0)
+                found = cp;
+            break;
+
+        case ';':
+            cp = Skip_To_Line_End(cp + 1, limit);
+            if (*cp == '\0' && cp < limit)
+                ++cp; // embedded null, the comment goes on
+            break;
+
+        case '"':
+        case '{':
+            cp = Skip_String_Source(cp, limit);
+            break;
+
+        case '[':
+        case '(':
+            ++depth;
+            ++cp;
+            break;
+
+        case ']':
+        case ')':
+            if (depth > 0) // else it's an error the scan will report
+                --depth;
+            ++cp;
+            break;
+
+        default:
+            ++cp;
+            break;
+        }
+    }
+
+    return found;
+}
+
+
+//
+//  top-level-break: native [
+//
+//  {Find the last line break in UTF-8 source that isn't inside of a value.}
+//
+//      return: [binary! blank!]
+//          {Source at the position after the line break, or blank if none}
+//      source [binary!]
+//          {Source starting between top-level values, e.g. at its head}
+//  ]
+//
+// Lets large sources be cut into pieces for TRANSCODE without cutting a block
+// or string in two, see Find_Top_Level_Break().
+//
+REBNATIVE(top_level_break)
+{
+    INCLUDE_PARAMS_OF_TOP_LEVEL_BREAK;
+
+    REBVAL *source = ARG(source);
+    const REBYTE *bp = VAL_BIN_AT(source);
+
+    const REBYTE *found = Find_Top_Level_Break(bp, bp + VAL_LEN_AT(source));
+    if (found == NULL)
+        return R_BLANK;
+
+    Move_Value(D_OUT, source);
+    VAL_INDEX(D_OUT) += found - bp;
     return R_OUT;
 }
 
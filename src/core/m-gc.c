@@ -68,6 +68,11 @@
 
 #include "sys-core.h"
 
+#ifdef PARALLEL_SWEEP
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
 #include "mem-pools.h" // low-level memory pool access
 #include "mem-series.h" // low-level series memory access
 
@@ -818,6 +823,13 @@ static void Propagate_All_GC_Marks(void)
 
             Mark_Rebser_Only(hashlist);
         }
+        else if (GET_SER_INFO(a, ARRAY_INFO_HASHED)) {
+            //
+            // The hash index of an array is NULL when it has to be rebuilt.
+            //
+            if (SER(a)->link.hashlist != NULL)
+                Mark_Rebser_Only(SER(a)->link.hashlist);
+        }
 
         if (GET_SER_INFO(a, SERIES_INFO_INACCESSIBLE)) {
             //
@@ -838,11 +850,13 @@ static void Propagate_All_GC_Marks(void)
             //
             // Voids are illegal in most arrays, but the varlist of a context
             // uses void values to denote that the variable is not set.  Also
-            // reified C va_lists as Do_Core() sources can have them.
+            // reified C va_lists as Do_Core() sources can have them, and a
+            // map's pairlist keeps removed pairs with void values.
             //
             if (NOT(IS_BLANK_RAW(v)) && IS_VOID(v)) {
                 if(
                     !GET_SER_FLAG(a, ARRAY_FLAG_VARLIST)
+                    && !GET_SER_FLAG(a, ARRAY_FLAG_PAIRLIST)
                     && !GET_SER_FLAG(a, ARRAY_FLAG_VOIDS_LEGAL)
                 )
                     panic(a);
@@ -1032,6 +1046,59 @@ static void Mark_Symbol_Series(void)
 }
 
 
+//
+//  Mark_Alloc_Sample_Labels: C
+//
+// The function labels that allocations were tallied under are kept alive for
+// the report, see PROFILE-ALLOCATIONS.
+//
+static void Mark_Alloc_Sample_Labels(void)
+{
+    REBCNT n;
+    for (n = 0; n < TG_Alloc_Samples_Size; ++n) {
+        REB_ALLOC_SAMPLE *sample = &TG_Alloc_Samples[n];
+        if (sample->used && sample->label != NULL)
+            Mark_Rebser_Only(sample->label);
+    }
+}
+
+
+//
+//  Mark_Stack_Sample_Labels: C
+//
+// The function labels and file names of sampled call stacks are kept alive
+// for the report, see PROFILE.
+//
+static void Mark_Stack_Sample_Labels(void)
+{
+    REBCNT n;
+    for (n = 0; n < TG_Frame_Samples_Used; ++n) {
+        REB_FRAME_SAMPLE *frame = &TG_Frame_Samples[n];
+        if (frame->label != NULL)
+            Mark_Rebser_Only(frame->label);
+        if (frame->file != NULL)
+            Mark_Rebser_Only(frame->file);
+    }
+}
+
+
+//
+//  Mark_Function_Timing_Labels: C
+//
+// The labels of functions timed by PROFILE-FUNCTIONS are kept alive for the
+// report.  The functions themselves aren't (see Retire_Function_Timings()).
+//
+static void Mark_Function_Timing_Labels(void)
+{
+    REBCNT n;
+    for (n = 0; n < TG_Func_Timings_Size; ++n) {
+        REB_FUNC_TIMING *timing = &TG_Func_Timings[n];
+        if (timing->used && timing->label != NULL)
+            Mark_Rebser_Only(timing->label);
+    }
+}
+
+
 //
 //  Mark_Natives: C
 //
@@ -1206,17 +1273,52 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Decay_Swept_Node: C
+//
+// Free what a series the sweep found to be garbage holds on to, and leave
+// its node in the freed state (but not yet on the pool's free list).
+//
+static REBNOD *Decay_Swept_Node(REBSER *s)
+{
+    // !!! It would be nice if we could have NODE_FLAG_CELL here as part of
+    // the sweep's switch, but see its definition for why it is at position
+    // 8 from left and not an earlier bit.
+    //
+    // (A pairing has nothing to decay, Free_Pairing is for manuals)
+    //
+    if (NOT(s->header.bits & NODE_FLAG_CELL))
+        Decay_Series(s);
+
+    // See Init_Endlike_Header() for why we do this
+    //
+    REBNOD *node = cast(REBNOD*, s);
+    struct Reb_Header *alias = &node->header;
+    alias->bits = FLAGBYTE_FIRST(FREED_SERIES_BYTE);
+
+    return node;
+}
+
+
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with MANAGE_SERIES(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+//  Sweep_Series_Segment: C
 //
-static REBCNT Sweep_Series(void)
+// Scans the series nodes (REBSER structs) in one segment of the SER_POOL.
+// If a series had its lifetime management delegated to the garbage collector
+// with MANAGE_SERIES(), then if it didn't get "marked" as live during the
+// marking phase then free it.
+//
+// The nodes freed are not put on the pool's free list one at a time, but
+// threaded into a chain private to the segment that is spliced into the pool
+// once the segment is done.  Segments are thus independent units of sweeping
+// work: nothing but the splice touches state shared between them.
+//
+static REBCNT Sweep_Series_Segment(REBSEG *seg, REBCNT *survived)
 {
     REBCNT count = 0;
 
+    REBNOD *chain_first = NULL;
+    REBNOD *chain_last = NULL;
+
     // Optimization here depends on SWITCH of a bank of 4 bits.
     //
     static_assert_c(
@@ -1226,92 +1328,351 @@ static REBCNT Sweep_Series(void)
         && (NODE_FLAG_NODE == FLAGIT_LEFT(0)) // 0x8 after right shift
     );
 
+    REBSER *s = cast(REBSER*, seg + 1);
+    REBCNT n;
+    for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        switch (LEFT_N_BITS(s->header.bits, 4)) {
+        case 0:
+        case 1: // 0x1
+        case 2: // 0x2
+        case 3: // 0x2 + 0x1
+        case 4: // 0x4
+        case 5: // 0x4 + 0x1
+        case 6: // 0x4 + 0x2
+        case 7: // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (s);
+
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+
+        case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            break;
+
+        case 9:
+            // 0x8 + 0x1: marked but not managed, this can't happen,
+            // because the marking itself asserts nodes are managed.
+            //
+            panic (s);
+
+        case 10: {
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            REBNOD *node = Decay_Swept_Node(s);
+
+            if (chain_last == NULL)
+                chain_first = node;
+            else
+                chain_last->next_if_free = node;
+            chain_last = node;
+
+            ++count;
+            break; }
+
+        case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark.
+            //
+            s->header.bits &= ~NODE_FLAG_MARKED;
+            ++*survived;
+            break;
+
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
+
+        case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(LEFT_8_BITS(s->header.bits) == FREED_SERIES_BYTE);
+            break;
+
+        case 13:
+            // 0x8 + 0x4 + 0x1: "free unmanaged marked node" (?!)
+            //
+            panic (s);
+
+        case 14:
+            // 0x8 + 0x4 + 0x2: "free managed unmarked node" (?!)
+            //
+            panic (s);
+
+        case 15:
+            // 0x8 + 0x4 + 0x2 + 0x1: "free managed marked node" (?!)
+            //
+            panic (s);
+        }
+    }
+
+    if (count != 0)
+        Splice_Free_Nodes(SER_POOL, chain_first, chain_last, count);
+
+    return count;
+}
+
+
+#ifdef PARALLEL_SWEEP
+
+// A sweep isn't split across threads unless each would get this many
+// segments, as starting them would take a good part of the time saved.
+//
+#define MIN_SWEEP_SEGS_PER_THREAD 4
+
+// Limit on threads, whatever system/options/sweep-threads says.
+//
+#define MAX_SWEEP_THREADS 64
+
+// A run of segments for a thread to scan.  A bit is set in `dead` for each
+// node that is garbage, and the marks of the live nodes are cleared.
+//
+struct sweep_job {
     REBSEG *seg;
-    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
+    REBCNT num_segs;
+    REBCNT *dead; // (units + 31) / 32 words of bits per segment
+    REBCNT survived;
+    REBSER *bad; // a node with a header no sweep should see, else NULL
+    pthread_t thread;
+    REBOOL started;
+};
+
+
+//
+//  Run_Sweep_Job: C
+//
+// Only the headers of the job's own nodes are read or written, and nothing
+// is allocated or freed.  Anything that can't be checked that way is left
+// to the thread that started the sweep.
+//
+static void *Run_Sweep_Job(void *arg)
+{
+    struct sweep_job *job = cast(struct sweep_job*, arg);
+    REBCNT units = Mem_Pools[SER_POOL].units;
+    REBCNT words = (units + 31) / 32;
+
+    REBSEG *seg = job->seg;
+    REBCNT *dead = job->dead;
+    REBCNT i;
+    for (i = 0; i < job->num_segs; ++i, seg = seg->next, dead += words) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = 0; n < units; ++n, ++s) {
             switch (LEFT_N_BITS(s->header.bits, 4)) {
-            case 0:
-            case 1: // 0x1
-            case 2: // 0x2
-            case 3: // 0x2 + 0x1
-            case 4: // 0x4
-            case 5: // 0x4 + 0x1
-            case 6: // 0x4 + 0x2
-            case 7: // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (s);
-
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
-
-            case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
+            case 8: // unmanaged
+            case 12: // free
                 break;
 
-            case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (s);
-
-            case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (s->header.bits & NODE_FLAG_CELL)
-                    Free_Node(SER_POOL, s); // Free_Pairing is for manuals
-                else
-                    GC_Kill_Series(s);
-                ++count;
+            case 10: // managed but not marked, garbage
+                dead[n / 32] |= cast(REBCNT, 1) << (n % 32);
                 break;
 
-            case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
+            case 11: // managed and marked, live
                 s->header.bits &= ~NODE_FLAG_MARKED;
+                ++job->survived;
                 break;
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
-
-            case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(LEFT_8_BITS(s->header.bits) == FREED_SERIES_BYTE);
+            default: // see Sweep_Series_Segment()
+                if (job->bad == NULL)
+                    job->bad = s;
                 break;
+            }
+        }
+    }
+    return NULL;
+}
 
-            case 13:
-                // 0x8 + 0x4 + 0x1: "free unmanaged marked node" (?!)
-                //
-                panic (s);
 
-            case 14:
-                // 0x8 + 0x4 + 0x2: "free managed unmarked node" (?!)
-                //
-                panic (s);
+//
+//  Sweep_Series_Parallel: C
+//
+// The segments are divided into runs that threads scan at the same time,
+// clearing the marks on live nodes and noting which are garbage.  Freeing
+// the garbage runs HANDLE! cleaners and updates the word table (among other
+// things that aren't thread-safe), so it is then done on this thread, one
+// segment at a time as Sweep_Series_Segment() would.
+//
+// Returns FALSE if the sweep wasn't done, e.g. it's too small to be split.
+//
+static REBOOL Sweep_Series_Parallel(REBCNT threads, REBCNT *count)
+{
+    REBPOL *pool = &Mem_Pools[SER_POOL];
 
-            case 15:
-                // 0x8 + 0x4 + 0x2 + 0x1: "free managed marked node" (?!)
-                //
-                panic (s);
+    REBCNT num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != NULL; seg = seg->next)
+        ++num_segs;
+
+    if (threads > MAX_SWEEP_THREADS)
+        threads = MAX_SWEEP_THREADS;
+    if (threads > num_segs / MIN_SWEEP_SEGS_PER_THREAD)
+        threads = num_segs / MIN_SWEEP_SEGS_PER_THREAD;
+    if (threads < 2)
+        return FALSE;
+
+    REBCNT units = pool->units;
+    REBCNT words = (units + 31) / 32;
+    REBCNT *bits = ALLOC_N(REBCNT, words * num_segs);
+    if (bits == NULL)
+        return FALSE;
+    memset(bits, 0, sizeof(REBCNT) * words * num_segs);
+
+    struct sweep_job jobs[MAX_SWEEP_THREADS];
+
+    seg = pool->segs;
+    REBCNT done = 0;
+    REBCNT n;
+    for (n = 0; n < threads; ++n) {
+        struct sweep_job *job = &jobs[n];
+        REBCNT upto = cast(REBCNT,
+            (cast(REBU64, num_segs) * (n + 1)) / threads
+        );
+        job->seg = seg;
+        job->num_segs = upto - done;
+        job->dead = bits + done * words;
+        job->survived = 0;
+        job->bad = NULL;
+
+        for (; done < upto; ++done)
+            seg = seg->next;
+    }
+    assert(seg == NULL);
+
+    for (n = 1; n < threads; ++n)
+        jobs[n].started = LOGICAL(
+            0 == pthread_create(&jobs[n].thread, NULL, &Run_Sweep_Job, &jobs[n])
+        );
+
+    Run_Sweep_Job(&jobs[0]);
+
+    for (n = 1; n < threads; ++n) {
+        if (jobs[n].started)
+            pthread_join(jobs[n].thread, NULL);
+        else
+            Run_Sweep_Job(&jobs[n]);
+    }
+
+    REBCNT survived = 0;
+    for (n = 0; n < threads; ++n) {
+        if (jobs[n].bad != NULL)
+            panic (jobs[n].bad);
+        survived += jobs[n].survived;
+    }
+
+    // Freeing a series may free others, so a node noted as garbage is only
+    // decayed if it hasn't been freed since.  (Nodes it allocates come off
+    // the free list, and so weren't noted.)
+    //
+    REBCNT swept = 0;
+    REBCNT *dead = bits;
+    for (seg = pool->segs; seg != NULL; seg = seg->next, dead += words) {
+        REBSER *base = cast(REBSER*, seg + 1);
+
+        REBNOD *chain_first = NULL;
+        REBNOD *chain_last = NULL;
+        REBCNT chained = 0;
+
+        REBCNT w;
+        for (w = 0; w < words; ++w) {
+            REBCNT word = dead[w];
+            while (word != 0) {
+                REBCNT bit = 0;
+                while (NOT(word & (cast(REBCNT, 1) << bit)))
+                    ++bit;
+                word &= ~(cast(REBCNT, 1) << bit);
+
+                REBSER *s = base + (w * 32 + bit);
+                if (LEFT_N_BITS(s->header.bits, 4) != 10)
+                    continue;
+
+                REBNOD *node = Decay_Swept_Node(s);
+                if (chain_last == NULL)
+                    chain_first = node;
+                else
+                    chain_last->next_if_free = node;
+                chain_last = node;
+                ++chained;
             }
         }
+
+        if (chained != 0)
+            Splice_Free_Nodes(SER_POOL, chain_first, chain_last, chained);
+        swept += chained;
     }
 
+    FREE_N(REBCNT, words * num_segs, bits);
+
+    *count = swept;
+    GC_Stats.Swept_Last = swept;
+    GC_Stats.Survived_Last = survived;
+    return TRUE;
+}
+
+#endif
+
+
+//
+//  Sweep_Threads: C
+//
+// How many threads an eager sweep of the SER_POOL may be split across, from
+// system/options/sweep-threads.  That is 1 in builds without PARALLEL_SWEEP.
+//
+static REBCNT Sweep_Threads(void)
+{
+#ifdef PARALLEL_SWEEP
+    if (PG_Boot_Phase < BOOT_ERRORS)
+        return 1;
+
+    REBVAL *option = Get_System(SYS_OPTIONS, OPTIONS_SWEEP_THREADS);
+
+    REBI64 threads;
+    if (IS_INTEGER(option))
+        threads = VAL_INT64(option);
+    else
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (threads < 1)
+        return 1;
+    if (threads > MAX_SWEEP_THREADS)
+        threads = MAX_SWEEP_THREADS;
+    return cast(REBCNT, threads);
+#else
+    return 1;
+#endif
+}
+
+
+//
+//  Sweep_Series: C
+//
+// Sweeps all the segments that are part of the SER_POOL, splitting the work
+// across `threads` threads if the build supports it and the pool is large.
+//
+static REBCNT Sweep_Series(REBCNT threads)
+{
+    REBCNT count = 0;
+
+#ifdef PARALLEL_SWEEP
+    if (threads > 1 && Sweep_Series_Parallel(threads, &count))
+        return count;
+#else
+    UNUSED(threads);
+#endif
+
+    REBCNT survived = 0;
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next)
+        count += Sweep_Series_Segment(seg, &survived);
+
+    GC_Stats.Swept_Last = count;
+    GC_Stats.Survived_Last = survived;
     return count;
 }
 
@@ -1372,13 +1733,228 @@ REBCNT Fill_Sweeplist(REBSER *sweeplist)
 
 
 //
-//  Recycle_Core: C
+//  Heap_Bytes: C
 //
-// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
-// to be a series whose width is sizeof(REBSER*), and it will be filled with
-// the list of series that *would* be recycled.
+// Pool segments are never given back until Trim_Pools(), so PG_Mem_Usage
+// includes nodes that are sitting on free lists.  Those don't count as being
+// in use.
 //
-REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
+static REBI64 Heap_Bytes(void)
+{
+    REBI64 pooled_free = 0;
+    REBCNT n;
+    for (n = 0; n < SYSTEM_POOL; ++n)
+        pooled_free += cast(REBI64, Mem_Pools[n].free) * Mem_Pools[n].wide;
+
+    return cast(REBI64, PG_Mem_Usage) - pooled_free;
+}
+
+
+//
+//  Adapt_Ballast: C
+//
+// R3-Alpha reset the ballast to a fixed amount after every recycle.  That
+// means a program holding a large amount of live data pays for a full mark
+// of all of it every few megabytes of allocation, while a small program
+// gets no benefit from the fixed setting being raised.  (Atronix tried to
+// scale the ballast up or down by half based on how much of it was left,
+// but that logic was not correct: https://github.com/zsx/r3/issues/32)
+//
+// The policy here is that of collectors like Go's (GOGC) or Lua's "pause":
+// let allocation grow the heap by a percentage of the data found live, so
+// the cost of marking is amortized over a proportional amount of new work.
+// The survival rate is what drives this--a sweep that frees little leaves
+// a large live size, and pushes the next collection out.  RECYCLE/BALLAST
+// remains the floor, so small heaps collect just as often as before.
+//
+// `live_bytes` is what the heap had in use once garbage was swept out of it.
+//
+static REBI64 Adapt_Ballast(REBI64 live_bytes)
+{
+    GC_Stats.Live_Bytes = live_bytes;
+
+    REBI64 ballast = VAL_INT32(TASK_MAX_BALLAST);
+
+    // The options object is not available early in boot, and BLANK! for
+    // the growth setting is a request to keep the ballast fixed.
+    //
+    if (PG_Boot_Phase >= BOOT_ERRORS) {
+        REBVAL *growth = Get_System(SYS_OPTIONS, OPTIONS_RECYCLE_GROWTH);
+        if (IS_INTEGER(growth) && VAL_INT64(growth) > 0) {
+            REBI64 grown = (GC_Stats.Live_Bytes / 100) * VAL_INT64(growth);
+            if (grown > ballast)
+                ballast = grown;
+        }
+    }
+
+    if (ballast > MAX_I32)
+        ballast = MAX_I32;
+
+    return ballast;
+}
+
+
+//
+//  Trim_Pools: C
+//
+// Once a sweep has freed everything it is going to, give the segments of the
+// pools that are now empty back to the system (see Release_Empty_Segments).
+//
+static void Trim_Pools(void)
+{
+    // Like the growth setting for the ballast, the reserve can't be read
+    // early in boot, and BLANK! means segments are never given back.
+    //
+    if (PG_Boot_Phase < BOOT_ERRORS)
+        return;
+
+    REBVAL *reserve = Get_System(SYS_OPTIONS, OPTIONS_POOL_RESERVE);
+    if (NOT(IS_INTEGER(reserve)) || VAL_INT64(reserve) < 0)
+        return;
+
+    REBCNT n;
+    for (n = 0; n < SYSTEM_POOL; ++n)
+        GC_Stats.Released_Bytes += Release_Empty_Segments(
+            n, cast(REBCNT, VAL_INT32(reserve))
+        );
+}
+
+
+//
+//  Premark_Node: C
+//
+// While a lazy sweep is pending, a node can be managed in a segment the sweep
+// has yet to reach.  It was not around to be marked, so it is marked as it
+// becomes managed ("allocated black") and remembered, so the mark can be
+// taken off again once the sweep is over.  The same goes for spellings that
+// interning hands back out: they may be garbage that just hasn't been freed.
+//
+void Premark_Node(REBNOD *node)
+{
+    assert(GC_Sweep_Next != NULL);
+
+    if (node->header.bits & NODE_FLAG_MARKED)
+        return; // marked by the recycle, or already premarked
+
+    node->header.bits |= NODE_FLAG_MARKED;
+
+    if (SER_FULL(GC_Premarked))
+        Extend_Series(GC_Premarked, 8);
+
+    *SER_AT(REBNOD*, GC_Premarked, SER_LEN(GC_Premarked)) = node;
+    SET_SERIES_LEN(GC_Premarked, SER_LEN(GC_Premarked) + 1);
+}
+
+
+//
+//  End_Lazy_Sweep: C
+//
+// Every segment that was around for the marking has now been swept, so the
+// marks left on premarked nodes can be cleared.  With the garbage freed, the
+// ballast can be checked against the live size that is now known.
+//
+static void End_Lazy_Sweep(void)
+{
+    REBNOD **node = SER_HEAD(REBNOD*, GC_Premarked);
+    REBCNT n;
+    for (n = SER_LEN(GC_Premarked); n > 0; --n, ++node) {
+        assert(NOT((*node)->header.bits & NODE_FLAG_FREE));
+        (*node)->header.bits &= ~NODE_FLAG_MARKED;
+    }
+    SET_SERIES_LEN(GC_Premarked, 0);
+
+    Trim_Pools();
+
+    VAL_INT64(TASK_BALLAST) = Adapt_Ballast(GC_Stats.Live_Bytes);
+    if (GC_Ballast > VAL_INT32(TASK_BALLAST))
+        GC_Ballast = VAL_INT32(TASK_BALLAST);
+}
+
+
+//
+//  Sweep_Lazy_Segment: C
+//
+// Do the sweep of the next SER_POOL segment a lazy recycle left unswept.
+// Segments that Fill_Pool() adds are put at the head of the list, so only the
+// segments that existed when marking was done are visited.
+//
+// Freeing series can run the cleanup hooks of HANDLE!s, which may allocate.
+// A segment must be finished before the next is started, so FALSE is returned
+// if asked for a segment while one is in progress (or there are none left).
+//
+REBOOL Sweep_Lazy_Segment(void)
+{
+    if (GC_Sweep_Next == NULL || GC_Sweeping)
+        return FALSE;
+
+    GC_Sweeping = TRUE;
+
+    // The heap was all counted as live when marking was done, so take off
+    // what the sweep frees.  (Allocations made since then aren't counted.)
+    //
+    REBI64 heap_before = Heap_Bytes();
+
+    REBSEG *seg = GC_Sweep_Next;
+    GC_Stats.Swept_Last += Sweep_Series_Segment(seg, &GC_Stats.Survived_Last);
+
+    GC_Stats.Live_Bytes -= heap_before - Heap_Bytes();
+
+    GC_Sweeping = FALSE;
+
+    GC_Sweep_Next = seg->next;
+    if (GC_Sweep_Next == NULL)
+        End_Lazy_Sweep();
+
+    return TRUE;
+}
+
+
+//
+//  Sweep_Lazily: C
+//
+// Run for SIG_SWEEP, raised when Make_Node() found the SER_POOL's free list
+// empty while a sweep is pending.  The pool was filled so the allocation
+// could go ahead, and segments are swept here until they have given back a
+// segment's worth of nodes (or the sweep is done).  Sweeping only until the
+// pool had that many free would stop after one segment, as the filling just
+// added them, and the pool would grow by a segment for each one swept.
+//
+// If the pool runs out again before the signal is seen, Make_Node() finishes
+// the sweep instead (see Load_Magazine()).
+//
+void Sweep_Lazily(void)
+{
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    REBCNT wanted = pool->free + pool->units;
+    while (GC_Sweep_Next != NULL && pool->free < wanted)
+        if (NOT(Sweep_Lazy_Segment()))
+            break;
+}
+
+
+//
+//  Finish_Lazy_Sweep: C
+//
+// Sweep any segments a lazy recycle has left, e.g. before marking starts
+// again, or before code that walks the pool and mustn't see the garbage.
+//
+void Finish_Lazy_Sweep(void)
+{
+    assert(NOT(GC_Sweeping));
+
+    while (GC_Sweep_Next != NULL)
+        if (NOT(Sweep_Lazy_Segment()))
+            break;
+}
+
+
+//
+//  Mark_And_Sweep: C
+//
+// Common code for Recycle_Core() and Recycle_Lazily().  If `lazy` then the
+// SER_POOL is not swept before returning, see Sweep_Lazy_Segment().
+//
+static REBCNT Mark_And_Sweep(REBOOL shutdown, REBOOL lazy, REBSER *sweeplist)
 {
     // Ordinarily, it should not be possible to spawn a recycle during a
     // recycle.  But when debug code is added into the recycling code, it
@@ -1405,6 +1981,15 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
     GC_Recycling = TRUE;
 #endif
 
+    // Pause timings are not taken during shutdown, where the host services
+    // may be in the process of going away (and the numbers are of no use).
+    //
+    REBI64 pause_start = shutdown ? 0 : OS_DELTA_TIME(0, 0);
+
+    // Marks can't be trusted until any prior lazy sweep has cleared them.
+    //
+    Finish_Lazy_Sweep();
+
     ASSERT_NO_GC_MARKS_PENDING();
 
     Reify_Any_C_Valist_Frames();
@@ -1439,6 +2024,10 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
         Mark_Guarded_Nodes();
 
+        Mark_Alloc_Sample_Labels();
+        Mark_Stack_Sample_Labels();
+        Mark_Function_Timing_Labels();
+
         Mark_Frame_Stack_Deep();
 
         // Mark potential error object from callback!
@@ -1450,12 +2039,15 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 
         Mark_Devices_Deep();
 
+        Retire_Function_Timings(); // functions not marked by now are garbage
     }
 
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+    REBI64 sweep_start = shutdown ? 0 : OS_DELTA_TIME(0, 0);
+
     REBCNT count = 0;
 
     if (sweeplist != NULL) {
@@ -1465,8 +2057,15 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
         count += Fill_Sweeplist(sweeplist);
     #endif
     }
+    else if (lazy) {
+        assert(NOT(shutdown));
+        GC_Stats.Swept_Last = 0;
+        GC_Stats.Survived_Last = 0;
+        GC_Stats.Live_Bytes = Heap_Bytes(); // garbage taken off as it's swept
+        GC_Sweep_Next = Mem_Pools[SER_POOL].segs;
+    }
     else
-        count += Sweep_Series();
+        count += Sweep_Series(shutdown ? 1 : Sweep_Threads());
 
     // !!! The intent is for GOB! to be unified in the REBNOD pattern, the
     // way that the FFI structures were.  So they are not included in the
@@ -1483,37 +2082,34 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
     PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
 #endif
 
+    if (!shutdown && GC_Sweep_Next == NULL)
+        Trim_Pools(); // else done when the lazy sweep ends
+
     // Do not adjust task variables or boot strings in shutdown when they
     // are being freed.
     //
     if (!shutdown) {
         //
-        // !!! This code was added by Atronix to deal with frequent garbage
-        // collection, but the logic is not correct.  The issue has been
-        // raised and is commented out pending a correct solution.
-        //
-        // https://github.com/zsx/r3/issues/32
+        // While a lazy sweep is pending the garbage is still in the heap, and
+        // would be counted as live.  End_Lazy_Sweep() adapts the ballast once
+        // it's gone, so until then the last estimate is used.
         //
-        /*if (GC_Ballast <= VAL_INT32(TASK_BALLAST) / 2
-            && VAL_INT64(TASK_BALLAST) < MAX_I32) {
-            //increasing ballast by half
-            VAL_INT64(TASK_BALLAST) /= 2;
-            VAL_INT64(TASK_BALLAST) *= 3;
-        } else if (GC_Ballast >= VAL_INT64(TASK_BALLAST) * 2) {
-            //reduce ballast by half
-            VAL_INT64(TASK_BALLAST) /= 2;
-        }
-
-        // avoid overflow
-        if (
-            VAL_INT64(TASK_BALLAST) < 0
-            || VAL_INT64(TASK_BALLAST) >= MAX_I32
-        ) {
-            VAL_INT64(TASK_BALLAST) = MAX_I32;
-        }*/
-
+        if (GC_Sweep_Next == NULL)
+            VAL_INT64(TASK_BALLAST) = Adapt_Ballast(Heap_Bytes());
         GC_Ballast = VAL_INT32(TASK_BALLAST);
 
+        // Note that time spent in the sweep includes the time of running any
+        // cleanup hooks of HANDLE!s that were freed, which is arbitrary code.
+        //
+        REBI64 pause_end = OS_DELTA_TIME(0, 0);
+        ++GC_Stats.Recycles;
+        GC_Stats.Mark_Last = sweep_start - pause_start;
+        GC_Stats.Sweep_Last = pause_end - sweep_start;
+        GC_Stats.Pause_Last = pause_end - pause_start;
+        GC_Stats.Pause_Total += GC_Stats.Pause_Last;
+        if (GC_Stats.Pause_Last > GC_Stats.Pause_Max)
+            GC_Stats.Pause_Max = GC_Stats.Pause_Last;
+
         if (Reb_Opts->watch_recycle)
             Debug_Fmt(RM_WATCH_RECYCLE, count);
     }
@@ -1528,6 +2124,43 @@ REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
 }
 
 
+//
+//  Recycle_Core: C
+//
+// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
+// to be a series whose width is sizeof(REBSER*), and it will be filled with
+// the list of series that *would* be recycled.
+//
+REBCNT Recycle_Core(REBOOL shutdown, REBSER *sweeplist)
+{
+    return Mark_And_Sweep(shutdown, FALSE, sweeplist);
+}
+
+
+//
+//  Recycle_Lazily: C
+//
+// The recycle run when the ballast has been used up by allocations.  Unless
+// system/options/lazy-sweep is turned off, it only does the marking before
+// returning.  The SER_POOL is swept a segment at a time when its free list
+// runs out (at the next signal check, see Sweep_Lazily()), and whatever is
+// left gets swept by the next recycle.  That takes
+// the sweep (typically the bulk of a pause with a large heap) out of the
+// pause, and frees memory close to when it's going to be reused.
+//
+// Nodes managed while the sweep is pending are marked as they are managed,
+// see Premark_Node().
+//
+void Recycle_Lazily(void)
+{
+    REBOOL lazy = TRUE;
+    if (PG_Boot_Phase >= BOOT_ERRORS)
+        lazy = IS_TRUTHY(Get_System(SYS_OPTIONS, OPTIONS_LAZY_SWEEP));
+
+    Mark_And_Sweep(FALSE, lazy, NULL);
+}
+
+
 //
 //  Recycle: C
 //
@@ -1618,6 +2251,8 @@ void Guard_Node_Core(const REBNOD *node)
 //
 REBARR *Snapshot_All_Functions(void)
 {
+    Finish_Lazy_Sweep(); // don't report functions that are garbage
+
     REBDSP dsp_orig = DSP;
 
     REBSEG *seg;
@@ -1659,10 +2294,18 @@ void Startup_GC(void)
 
     GC_Ballast = MEM_BALLAST;
 
+    CLEARS(&GC_Stats);
+
     // Temporary series and values protected from GC. Holds node pointers.
     //
     GC_Guarded = Make_Series(15, sizeof(REBNOD*));
 
+    // Nodes given a mark while a lazy sweep is pending (see Premark_Node)
+    //
+    GC_Sweep_Next = NULL;
+    GC_Sweeping = FALSE;
+    GC_Premarked = Make_Series(15, sizeof(REBNOD*));
+
     // The marking queue used in lieu of recursion to ensure that deeply
     // nested structures don't cause the C stack to overflow.
     //
@@ -1676,7 +2319,12 @@ void Startup_GC(void)
 //
 void Shutdown_GC(void)
 {
+    Free_Alloc_Samples();
+    Free_Stack_Samples();
+    Free_Function_Timings();
+
     Free_Series(GC_Guarded);
+    Free_Series(GC_Premarked);
     Free_Series(GC_Mark_Stack);
 }
 
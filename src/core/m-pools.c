@@ -173,17 +173,59 @@ void Free_Mem(void *mem, size_t size)
 }
 
 
+//
+//  Realloc_Mem: C
+//
+// Resize a block from Alloc_Mem(), keeping its contents up to the smaller of
+// the two sizes.  Like Free_Mem(), the caller must give the current size.
+//
+// For large blocks, the C library can often grow the allocation where it is
+// (e.g. glibc serves big blocks with mmap() and resizes them with mremap())
+// which avoids having to copy the data.  If the block can't be resized then
+// NULL is returned, and the original block is left as it was.
+//
+void *Realloc_Mem(void *mem, size_t old_size, size_t new_size)
+{
+    // Trap memory usage limit *before* the allocation is performed
+
+    PG_Mem_Usage += new_size;
+    PG_Mem_Usage -= old_size;
+    if ((PG_Mem_Limit != 0) && (PG_Mem_Usage > PG_Mem_Limit))
+        Check_Security(Canon(SYM_MEMORY), POL_EXEC, 0);
+
+#ifdef NDEBUG
+    void *ptr = realloc(mem, new_size);
+#else
+    assert(mem != NULL);
+    char *old_ptr = cast(char *, mem) - sizeof(REBI64);
+    assert(*cast(REBI64*, old_ptr) == cast(REBI64, old_size));
+
+    void *ptr = realloc(old_ptr, new_size + sizeof(REBI64));
+    if (ptr != NULL) {
+        *cast(REBI64 *, ptr) = new_size;
+        ptr = cast(char *, ptr) + sizeof(REBI64);
+    }
+#endif
+
+    if (ptr == NULL) {
+        PG_Mem_Usage += old_size;
+        PG_Mem_Usage -= new_size;
+    }
+    return ptr;
+}
+
+
 #define POOL_MAP
 
 #ifdef POOL_MAP
     #ifdef NDEBUG
         #define FIND_POOL(n) \
-            ((n <= 4 * MEM_BIG_SIZE) \
+            ((n <= MEM_POOLED_MAX) \
                 ? cast(REBCNT, PG_Pool_Map[n]) \
                 : cast(REBCNT, SYSTEM_POOL))
     #else
         #define FIND_POOL(n) \
-            ((!PG_Always_Malloc && (n <= 4 * MEM_BIG_SIZE)) \
+            ((!PG_Always_Malloc && (n <= MEM_POOLED_MAX)) \
                 ? cast(REBCNT, PG_Pool_Map[n]) \
                 : cast(REBCNT, SYSTEM_POOL))
     #endif
@@ -242,6 +284,10 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
     DEF_POOL(MEM_BIG_SIZE*2, 8),    // 2K
     DEF_POOL(MEM_BIG_SIZE*3, 4),    // 3K
     DEF_POOL(MEM_BIG_SIZE*4, 4),    // 4K
+    DEF_POOL(MEM_BIG_SIZE*5, 4),    // 5K
+    DEF_POOL(MEM_BIG_SIZE*6, 4),    // 6K
+    DEF_POOL(MEM_BIG_SIZE*7, 4),    // 7K
+    DEF_POOL(MEM_BIG_SIZE*8, 4),    // 8K
 
     DEF_POOL(sizeof(REBSER), 4096), // Series headers
     DEF_POOL(sizeof(REBGOB), 128),  // Gobs
@@ -270,15 +316,39 @@ void Startup_Pools(REBINT scale)
     }
 #endif
 
-    REBINT unscale = 1;
-    if (scale == 0)
-        scale = 1;
-    else if (scale < 0) {
-        unscale = -scale;
-        scale = 1;
+    // How many units each pool's segments hold can be scaled at startup,
+    // either by the `scale` argument or by the R3_POOL_SCALE environment
+    // variable.  The variable may give one scale for all pools, or a comma
+    // separated scale for each class: small, mid-size, and large series data,
+    // then the node pools (series headers and gobs).  A negative scale will
+    // divide instead of multiply.  Larger segments mean fewer trips to the
+    // system allocator for programs making a lot of series, and smaller ones
+    // mean less memory sitting in free lists for programs that don't.
+    //
+    REBINT scales[4] = {scale, scale, scale, scale};
+
+    const char *env_pool_scale = getenv("R3_POOL_SCALE");
+    if (env_pool_scale != NULL) {
+        const char *cp = env_pool_scale;
+        REBCNT i;
+        for (i = 0; i < 4; ++i) {
+            char *end;
+            long n = strtol(cp, &end, 10);
+            if (end == cp)
+                break; // no more given (an empty field, as in "4," ends it)
+            scales[i] = cast(REBINT, n);
+            if (*end != ',') {
+                ++i;
+                break;
+            }
+            cp = end + 1;
+        }
+        for (; i > 0 && i < 4; ++i)
+            scales[i] = scales[i - 1]; // last one given applies to the rest
     }
 
     Mem_Pools = ALLOC_N(REBPOL, MAX_POOLS);
+    Node_Magazines = ALLOC_N_ZEROFILL(REBMAG, MAX_POOLS);
 
     // Copy pool sizes to new pool structure:
     //
@@ -301,14 +371,26 @@ void Startup_Pools(REBINT scale)
 
         Mem_Pools[n].wide = Mem_Pool_Spec[n].wide;
 
-        Mem_Pools[n].units = (Mem_Pool_Spec[n].units * scale) / unscale;
+        REBINT class_scale = scales[
+            n < MEM_SMALL_POOLS ? 0
+            : n < MEM_MID_POOLS ? 1
+            : n < MEM_BIG_POOLS ? 2
+            : 3
+        ];
+        if (class_scale == 0)
+            class_scale = 1;
+
+        if (class_scale > 0)
+            Mem_Pools[n].units = Mem_Pool_Spec[n].units * class_scale;
+        else
+            Mem_Pools[n].units = Mem_Pool_Spec[n].units / -class_scale;
         if (Mem_Pools[n].units < 2) Mem_Pools[n].units = 2;
         Mem_Pools[n].free = 0;
         Mem_Pools[n].has = 0;
     }
 
     // For pool lookup. Maps size to pool index. (See Find_Pool below)
-    PG_Pool_Map = ALLOC_N(REBYTE, (4 * MEM_BIG_SIZE) + 1);
+    PG_Pool_Map = ALLOC_N(REBYTE, MEM_POOLED_MAX + 1);
 
     // sizes 0 - 8 are pool 0
     for (n = 0; n <= 8; n++) PG_Pool_Map[n] = 0;
@@ -316,14 +398,14 @@ void Startup_Pools(REBINT scale)
         PG_Pool_Map[n] = MEM_TINY_POOL + ((n-1) / MEM_MIN_SIZE);
     for (; n <= 32 * MEM_MIN_SIZE; n++)
         PG_Pool_Map[n] = MEM_SMALL_POOLS-4 + ((n-1) / (MEM_MIN_SIZE * 4));
-    for (; n <=  4 * MEM_BIG_SIZE; n++)
+    for (; n <= MEM_POOLED_MAX; n++)
         PG_Pool_Map[n] = MEM_MID_POOLS + ((n-1) / MEM_BIG_SIZE);
 
     // !!! Revisit where series init/shutdown goes when the code is more
     // organized to have some of the logic not in the pools file
 
 #if !defined(NDEBUG)
-    PG_Reb_Stats = ALLOC(REB_STATS);
+    PG_Reb_Stats = ALLOC_ZEROFILL(REB_STATS);
 #endif
 
     // Manually allocated series that GC is not responsible for (unless a
@@ -383,8 +465,9 @@ void Shutdown_Pools(void)
     }
 
     FREE_N(REBPOL, MAX_POOLS, Mem_Pools);
+    FREE_N(REBMAG, MAX_POOLS, Node_Magazines);
 
-    FREE_N(REBYTE, (4 * MEM_BIG_SIZE) + 1, PG_Pool_Map);
+    FREE_N(REBYTE, MEM_POOLED_MAX + 1, PG_Pool_Map);
 
     // !!! Revisit location (just has to be after all series are freed)
     FREE_N(REBSER*, MAX_EXPAND_LIST, Prior_Expand);
@@ -486,12 +569,134 @@ static void Fill_Pool(REBPOL *pool)
 }
 
 
+//
+//  Link_Free_Chain: C
+//
+// Put a chain of freed nodes on a pool's free list, at the head or the tail
+// depending on the build (see Splice_Free_Nodes()).  They aren't counted.
+//
+static void Link_Free_Chain(REBPOL *pool, REBNOD *first, REBNOD *last)
+{
+#ifdef NDEBUG
+    last->next_if_free = pool->first;
+    pool->first = first;
+#else
+    last->next_if_free = NULL;
+    if (pool->last == NULL) {
+        assert(pool->first == NULL);
+        pool->first = first;
+    }
+    else
+        pool->last->next_if_free = first;
+    pool->last = last;
+#endif
+}
+
+
+//
+//  Load_Magazine: C
+//
+// Take up to MAGAZINE_SIZE nodes off the head of a pool's free list in one
+// step, for an empty magazine.  If the free list has run out, the pool is
+// refilled first.
+//
+static void Load_Magazine(REBCNT pool_id)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    REBMAG *mag = &Node_Magazines[pool_id];
+    assert(mag->count == 0);
+
+    if (pool->first == NULL) {
+        //
+        // If the last recycle left its sweep to be done lazily, there is
+        // garbage waiting to be reclaimed.  The first time the pool runs out
+        // it is filled anyway, and the sweep is asked for at the next signal
+        // check.  But a native that allocates a lot (e.g. TRANSCODE, or a
+        // deep COPY) may not get to one, and growing the heap a segment each
+        // time it runs out would leave all that garbage behind.  So if the
+        // pool runs out again before then, the sweep is finished here.
+        // (Callers that hold on to a node which may be garbage premark it,
+        // and interning looks its slot up again after allocating.)
+        //
+        if (pool_id == SER_POOL && GC_Sweep_Next != NULL) {
+            if (NOT(GET_SIGNAL(SIG_SWEEP)))
+                SET_SIGNAL(SIG_SWEEP);
+            else if (NOT(GC_Sweeping)) { // not from a HANDLE! cleanup hook
+                Finish_Lazy_Sweep();
+                if (mag->count != 0)
+                    return; // loaded by a HANDLE! cleanup the sweep ran
+            }
+        }
+
+        if (pool->first == NULL)
+            Fill_Pool(pool);
+    }
+
+    assert(pool->first != NULL);
+
+    REBNOD *last = pool->first;
+    REBCNT count = 1;
+    while (count < MAGAZINE_SIZE && last->next_if_free != NULL) {
+        last = last->next_if_free;
+        ++count;
+    }
+
+    mag->top = pool->first;
+    mag->bottom = last;
+    mag->count = count;
+
+    pool->first = last->next_if_free;
+    if (pool->first == NULL)
+        pool->last = NULL;
+    last->next_if_free = NULL;
+}
+
+
+//
+//  Unload_Magazine: C
+//
+// Give the nodes in a pool's magazine back to its free list in one step.  As
+// they were already counted as free, the pool's `free` is left as it is.
+//
+static void Unload_Magazine(REBCNT pool_id)
+{
+    REBMAG *mag = &Node_Magazines[pool_id];
+    if (mag->count == 0)
+        return;
+
+    Link_Free_Chain(&Mem_Pools[pool_id], mag->top, mag->bottom);
+
+    mag->top = NULL;
+    mag->bottom = NULL;
+    mag->count = 0;
+}
+
+
+//
+//  Unload_Magazines: C
+//
+// Put all nodes held in magazines back on their pools' free lists, e.g. for
+// code that walks the free lists and needs to see every free node.
+//
+static void Unload_Magazines(void)
+{
+    REBCNT n;
+    for (n = 0; n < MAX_POOLS; ++n)
+        Unload_Magazine(n);
+}
+
+
 //
 //  Make_Node: C
 //
 // Allocate a node from a pool.  If the pool has run out of nodes, it will
 // be refilled.
 //
+// Nodes are handed out of the pool's magazine, which is loaded from the free
+// list a batch at a time.  Only loading and unloading touch the REBPOL, so
+// the magazines (like the rest of the TVAR state) are what would be kept per
+// thread if there were several allocating from the same pools.
+//
 // The node will not be zero-filled.  However its header bits will be
 // guaranteed to be zero--which is the same as the state of all freed nodes.
 // Callers likely want to change this to not be zero, so that zero can be
@@ -504,19 +709,16 @@ static void Fill_Pool(REBPOL *pool)
 //
 void *Make_Node(REBCNT pool_id)
 {
-    REBPOL *pool = &Mem_Pools[pool_id];
-    if (pool->first == NULL)
-        Fill_Pool(pool);
+    REBMAG *mag = &Node_Magazines[pool_id];
+    if (mag->count == 0)
+        Load_Magazine(pool_id);
 
-    assert(pool->first != NULL);
-
-    REBNOD *node = pool->first;
+    REBNOD *node = mag->top;
 
-    pool->first = node->next_if_free;
-    if (node == pool->last)
-        pool->last = NULL;
+    mag->top = node->next_if_free;
+    --mag->count;
 
-    pool->free--;
+    Mem_Pools[pool_id].free--;
 
     assert(cast(REBUPT, node) % sizeof(REBI64) == 0);
     assert(IS_FREE_NODE(node)); // client needs to change to non-zero
@@ -544,9 +746,18 @@ void Free_Node(REBCNT pool_id, void *p)
     REBPOL *pool = &Mem_Pools[pool_id];
 
 #ifdef NDEBUG
-    node->next_if_free = pool->first;
-    pool->first = node;
+    REBMAG *mag = &Node_Magazines[pool_id];
+    if (mag->count == MAGAZINE_SIZE)
+        Unload_Magazine(pool_id);
+
+    node->next_if_free = mag->top;
+    mag->top = node;
+    if (mag->count++ == 0)
+        mag->bottom = node;
 #else
+    // Freed nodes don't go into the magazine here, which would hand them
+    // right back out.
+    //
     // !!! In R3-Alpha, the most recently freed node would become the first
     // node to hand out.  This is a simple and likely good strategy for
     // cache usage, but makes the "poisoning" nearly useless.
@@ -571,6 +782,180 @@ void Free_Node(REBCNT pool_id, void *p)
 }
 
 
+//
+//  Splice_Free_Nodes: C
+//
+// Return a chain of nodes to a pool in one step, instead of one at a time
+// with Free_Node().  The nodes must already have freed headers, and be
+// linked through their `next_if_free` fields from `first` to `last`.
+//
+// Like Free_Node(), the release build puts the nodes at the head of the
+// free list (so recently touched memory is reused first) while the debug
+// build puts them at the tail (so stale pointers to them stay poisoned).
+//
+void Splice_Free_Nodes(
+    REBCNT pool_id,
+    REBNOD *first,
+    REBNOD *last,
+    REBCNT count
+){
+    assert(first != NULL && last != NULL && count != 0);
+
+    REBPOL *pool = &Mem_Pools[pool_id];
+    Link_Free_Chain(pool, first, last);
+    pool->free += count;
+}
+
+
+//
+//  Compare_Segments: C
+//
+// Orders segments by address, for looking up which one holds a node.
+//
+static int Compare_Segments(void *thunk, const void *v1, const void *v2)
+{
+    UNUSED(thunk);
+
+    REBUPT a1 = cast(REBUPT, *cast(REBSEG* const*, v1));
+    REBUPT a2 = cast(REBUPT, *cast(REBSEG* const*, v2));
+    return a1 < a2 ? -1 : (a1 > a2 ? 1 : 0);
+}
+
+
+//
+//  Find_Segment_Index: C
+//
+// Binary search of the address-ordered segments for the one holding a node.
+//
+static REBCNT Find_Segment_Index(REBSEG **segs, REBCNT num_segs, void *node)
+{
+    REBCNT lo = 0;
+    REBCNT hi = num_segs;
+    while (hi - lo > 1) {
+        REBCNT mid = lo + (hi - lo) / 2;
+        if (cast(REBYTE*, segs[mid]) < cast(REBYTE*, node))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    assert(cast(REBYTE*, segs[lo]) < cast(REBYTE*, node));
+    return lo;
+}
+
+
+//
+//  Release_Empty_Segments: C
+//
+// Segments are added by Fill_Pool() as a pool runs out of units, and before
+// this routine they were not freed until Shutdown_Pools().  So after a burst
+// of allocation (e.g. loading a big file) the memory stayed at its peak, with
+// the units sitting on free lists.
+//
+// This frees the segments whose units are all on the free list, except for
+// `reserve` of them that are kept for the next burst.  There's no count of
+// free units kept per segment (that would cost every Make_Node() and
+// Free_Node() a lookup of which segment they're in), so the free list is
+// walked to tally them.  That is only done when the pool has enough free
+// units that there could be an empty segment beyond the reserve.
+//
+// Returns the number of bytes given back to the system.
+//
+REBCNT Release_Empty_Segments(REBCNT pool_id, REBCNT reserve)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    if (pool->free < pool->units * (reserve + 1))
+        return 0;
+
+    Unload_Magazine(pool_id); // its nodes must be counted with the segments
+
+    REBCNT num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != NULL; seg = seg->next)
+        ++num_segs;
+
+    REBSEG **segs = ALLOC_N(REBSEG*, num_segs);
+    REBCNT *frees = ALLOC_N(REBCNT, num_segs);
+    if (segs == NULL || frees == NULL) {
+        if (segs != NULL)
+            FREE_N(REBSEG*, num_segs, segs);
+        if (frees != NULL)
+            FREE_N(REBCNT, num_segs, frees);
+        return 0; // not worth failing over
+    }
+
+    REBCNT i = 0;
+    for (seg = pool->segs; seg != NULL; seg = seg->next)
+        segs[i++] = seg;
+    reb_qsort_r(segs, num_segs, sizeof(REBSEG*), NULL, &Compare_Segments);
+
+    for (i = 0; i < num_segs; ++i)
+        frees[i] = 0;
+
+    REBNOD *node;
+    for (node = pool->first; node != NULL; node = node->next_if_free)
+        ++frees[Find_Segment_Index(segs, num_segs, node)];
+
+    // A count equal to the units means the segment will be released, so the
+    // segments kept in reserve get their count zeroed.
+    //
+    REBCNT kept = 0;
+    REBCNT released = 0;
+    for (i = 0; i < num_segs; ++i) {
+        if (frees[i] != pool->units)
+            continue;
+        if (kept < reserve) {
+            ++kept;
+            frees[i] = 0;
+        }
+        else
+            ++released;
+    }
+
+    if (released != 0) {
+        //
+        // Rebuild the free list without the units of the released segments,
+        // keeping the order (the debug build relies on recently freed nodes
+        // being at the tail, see Free_Node())
+        //
+        REBNOD *first = NULL;
+        REBNOD *last = NULL;
+        for (node = pool->first; node != NULL; node = node->next_if_free) {
+            if (frees[Find_Segment_Index(segs, num_segs, node)] == pool->units)
+                continue;
+            if (last == NULL)
+                first = node;
+            else
+                last->next_if_free = node;
+            last = node;
+        }
+        if (last != NULL)
+            last->next_if_free = NULL;
+        pool->first = first;
+        pool->last = last;
+
+        REBSEG **link = &pool->segs;
+        while ((seg = *link) != NULL) {
+            i = Find_Segment_Index(segs, num_segs, seg + 1);
+            if (frees[i] != pool->units) {
+                link = &seg->next;
+                continue;
+            }
+            *link = seg->next;
+            pool->has -= pool->units;
+            pool->free -= pool->units;
+            FREE_N(char, seg->size, cast(char*, seg));
+        }
+    }
+
+    REBCNT bytes = released * (pool->wide * pool->units + sizeof(REBSEG));
+
+    FREE_N(REBSEG*, num_segs, segs);
+    FREE_N(REBCNT, num_segs, frees);
+
+    return bytes;
+}
+
+
 //
 //  Series_Data_Alloc: C
 //
@@ -983,6 +1368,9 @@ REBSER *Make_Series_Core(REBCNT capacity, REBYTE wide, REBUPT flags)
         CLEAR_SER_FLAG(s, SERIES_FLAG_FILE_LINE);
     }
 
+    if (TG_Alloc_Sample_Countdown != 0 && --TG_Alloc_Sample_Countdown == 0)
+        Sample_Allocation(s); // see PROFILE-ALLOCATIONS
+
     assert(s->info.bits & NODE_FLAG_END);
     assert(NOT(s->info.bits & NODE_FLAG_CELL));
     assert(SER_LEN(s) == 0);
@@ -1032,6 +1420,9 @@ REBVAL *Alloc_Pairing(REBCTX *opt_owning_frame) {
     INIT_CELL(paired);
     TRASH_CELL_IF_DEBUG(paired);
 
+    if (TG_Alloc_Sample_Countdown != 0 && --TG_Alloc_Sample_Countdown == 0)
+        Sample_Allocation(s); // see PROFILE-ALLOCATIONS
+
 #if !defined(NDEBUG)
     s->guard = cast(int*, malloc(sizeof(*s->guard)));
     free(s->guard);
@@ -1057,6 +1448,9 @@ REBVAL *Alloc_Pairing(REBCTX *opt_owning_frame) {
 void Manage_Pairing(REBVAL *paired) {
     REBVAL *key = PAIRING_KEY(paired);
     SET_VAL_FLAG(key, NODE_FLAG_MANAGED);
+
+    if (GC_Sweep_Next != NULL)
+        Premark_Node(NOD(key)); // see Recycle_Lazily()
 }
 
 
@@ -1122,6 +1516,8 @@ static void Free_Unbiased_Series_Data(REBYTE *unbiased, REBCNT size_unpooled)
         pool = &Mem_Pools[pool_num];
         node->next_if_free = pool->first;
         pool->first = node;
+        if (pool->last == NULL)
+            pool->last = node; // list was empty, see Link_Free_Chain()
         pool->free++;
 
         // See Init_Endlike_Header() for why we do this
@@ -1188,6 +1584,8 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     if (delta == 0) return;
 
     REBCNT len_old = SER_LEN(s);
+    if (index < len_old)
+        Invalidate_Array_Indexes(s); // values after `index` will move
 
     REBYTE wide = SER_WIDE(s);
 
@@ -1311,6 +1709,82 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     }
 #endif
 
+    // A series too big for the pools, whose data starts at the head of its
+    // allocation, can be grown with Realloc_Mem().  For big allocations the
+    // C library may be able to do that without moving or copying anything.
+    //
+    if (was_dynamic && SER_BIAS(s) == 0) {
+        REBCNT total_old = Series_Allocation_Unpooled(s);
+        REBCNT length = len_old + delta + x;
+
+        REBCNT total_new = 2048; // same rounding as Series_Data_Alloc()
+        while (total_new < length * wide)
+            total_new *= 2;
+
+        REBYTE *data = NULL;
+        if (
+            FIND_POOL(total_old) == SYSTEM_POOL
+            && FIND_POOL(total_new) == SYSTEM_POOL
+        ){
+            assert(total_new > total_old);
+            data = cast(REBYTE*, Realloc_Mem(
+                s->content.dynamic.data, total_old, total_new
+            ));
+        }
+
+        if (data != NULL) {
+            s->content.dynamic.data = data;
+            s->content.dynamic.rest = total_new / wide;
+            if (total_new % wide == 0)
+                CLEAR_SER_FLAG(s, SERIES_FLAG_POWER_OF_2);
+            else
+                SET_SER_FLAG(s, SERIES_FLAG_POWER_OF_2);
+
+            Mem_Pools[SYSTEM_POOL].has += total_new - total_old;
+
+            if ((GC_Ballast -= total_new) <= 0)
+                SET_SIGNAL(SIG_RECYCLE);
+
+            if (n_found >= MAX_EXPAND_LIST)
+                Prior_Expand[n_available] = s;
+
+            memmove(data + start + extra, data + start, size - start);
+            s->content.dynamic.len = len_old + delta;
+
+            if (GET_SER_FLAG(s, SERIES_FLAG_ARRAY)) {
+                //
+                // Give the new capacity the cells and unwritable END that
+                // Series_Data_Alloc() would have, and overwrite the END that
+                // was at the end of the old capacity.
+                //
+                REBCNT n;
+                for (n = len_old + delta; n < SER_REST(s) - 1; ++n)
+                    INIT_CELL(ARR_AT(ARR(s), n));
+
+                RELVAL *ultimate = ARR_AT(ARR(s), SER_REST(s) - 1);
+                Init_Endlike_Header(&ultimate->header, 0);
+
+            #if !defined(NDEBUG)
+                Set_Track_Payload_Debug(ultimate, __FILE__, __LINE__);
+            #endif
+
+                // Unlike when the data is slid down in place, part of the gap
+                // may be past the old capacity, in memory the realloc left
+                // uninitialized.  So the gap is made cells in all builds.
+                //
+                for (n = index; n < index + delta; ++n)
+                    INIT_CELL(ARR_AT(ARR(s), n));
+            }
+
+            TERM_SERIES(s);
+
+        #if !defined(NDEBUG)
+            PG_Reb_Stats->Series_Expanded++;
+        #endif
+            return;
+        }
+    }
+
     // !!! The protocol for doing new allocations currently mandates that the
     // dynamic content area be cleared out.  But the data lives in the content
     // area if there's no dynamic portion.  The in-REBSER content has to be
@@ -1374,7 +1848,9 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
     PG_Reb_Stats->Series_Expanded++;
 #endif
 
-    assert(NOT_SER_FLAG(s, NODE_FLAG_MARKED));
+    // Only a pending lazy sweep leaves marks on series between recycles.
+    //
+    assert(GC_Sweep_Next != NULL || NOT_SER_FLAG(s, NODE_FLAG_MARKED));
 }
 
 
@@ -1518,13 +1994,18 @@ void Remake_Series(REBSER *s, REBCNT units, REBYTE wide, REBUPT flags)
 
 
 //
-//  GC_Kill_Series: C
+//  Decay_Series: C
 //
-// Only the garbage collector should be calling this routine.
-// It frees a series even though it is under GC management,
-// because the GC has figured out no references exist.
+// Release everything a series holds onto (its data allocation, its entry
+// as a canon spelling, the resource of a managed HANDLE!...) but leave the
+// REBSER node itself in place.  The caller is responsible for getting the
+// node back into SER_POOL, which GC_Kill_Series() does with Free_Node().
 //
-void GC_Kill_Series(REBSER *s)
+// The sweep in the garbage collector uses this directly, so that it can
+// collect the nodes it frees in a segment and hand them back to the pool
+// as a single chain.  (See Splice_Free_Nodes())
+//
+void Decay_Series(REBSER *s)
 {
     assert(!IS_FREE_NODE(s));
     assert(NOT(s->header.bits & NODE_FLAG_CELL)); // use Free_Paired
@@ -1587,8 +2068,6 @@ void GC_Kill_Series(REBSER *s)
 
     TRASH_POINTER_IF_DEBUG(s->link.keylist);
 
-    Free_Node(SER_POOL, s);
-
     // GC may no longer be necessary:
     if (GC_Ballast > 0) CLR_SIGNAL(SIG_RECYCLE);
 
@@ -1602,6 +2081,20 @@ void GC_Kill_Series(REBSER *s)
 }
 
 
+//
+//  GC_Kill_Series: C
+//
+// Only the garbage collector should be calling this routine.
+// It frees a series even though it is under GC management,
+// because the GC has figured out no references exist.
+//
+void GC_Kill_Series(REBSER *s)
+{
+    Decay_Series(s);
+    Free_Node(SER_POOL, s);
+}
+
+
 inline static void Drop_Manual_Series(REBSER *s)
 {
     REBSER ** const last_ptr
@@ -1767,6 +2260,9 @@ void Manage_Series(REBSER *s)
 
     s->header.bits |= NODE_FLAG_MANAGED;
 
+    if (GC_Sweep_Next != NULL)
+        Premark_Node(NOD(s)); // see Recycle_Lazily()
+
     Drop_Manual_Series(s);
 }
 
@@ -2122,6 +2618,8 @@ REBCNT Check_Memory_Debug(void)
 
     REBCNT total_free_nodes = 0;
 
+    Unload_Magazines();
+
     REBCNT pool_num;
     for (pool_num = 0; pool_num < SYSTEM_POOL; pool_num++) {
         REBCNT pool_free_nodes = 0;
@@ -951,6 +951,8 @@ static inline REBCNT Finalize_Remove_Each(struct Remove_Each_State *res)
 
     REBCNT count = 0;
     if (ANY_ARRAY(data)) {
+        Invalidate_Array_Indexes(series);
+
         REBCNT len = VAL_LEN_HEAD(data);
 
         RELVAL *dest = VAL_ARRAY_AT(data);
@@ -38,6 +38,56 @@ enum {
 };
 
 
+// Blocks no longer than this are matched up without making hashlists.
+//
+#define MAX_LINEAR_SET 16
+
+
+//
+//  Hash_Keys: C
+//
+// Put the hashes of the keys of the records in a block into `hashes`, and
+// return how many there are.  (Like Hash_Block(), but for small blocks.)
+//
+static REBCNT Hash_Keys(REBCNT *hashes, const REBVAL *block, REBCNT skip)
+{
+    if (VAL_LEN_AT(block) % skip != 0)
+        fail (Error_Block_Skip_Wrong_Raw());
+
+    REBCNT num = 0;
+    const RELVAL *key = VAL_ARRAY_AT(block);
+    for (; NOT_END(key); key += skip)
+        hashes[num++] = Hash_Value(key);
+
+    return num;
+}
+
+
+//
+//  Find_Key_Linear: C
+//
+// See if a key matches one of `num` records of `skip` values at `head`, whose
+// keys have the hashes in `hashes`.  It matches the same ones that a lookup
+// with Find_Key_Hashed() would.
+//
+static REBOOL Find_Key_Linear(
+    const RELVAL *head,
+    const REBCNT *hashes,
+    REBCNT num,
+    REBCNT skip,
+    const RELVAL *key,
+    REBCNT hash,
+    REBOOL cased
+){
+    REBCNT n;
+    for (n = 0; n < num; ++n) {
+        if (hashes[n] == hash && Match_Key(key, head + n * skip, cased) != 0)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+
 //
 //  Make_Set_Operation_Series: C
 //
@@ -106,39 +156,133 @@ static REBSER *Make_Set_Operation_Series(
         // efficient.
         //
         REBSER *buffer = SER(Make_Array(i));
-        hret = Make_Hash_Sequence(i);   // allocated
 
-        // Optimization note: !!
-        // This code could be optimized for small blocks by not hashing them
-        // and extending Find_Key to FIND on the value itself w/o the hash.
+        // Small blocks aren't worth making hashlists for.  The hashes of
+        // their keys are kept in these arrays instead, and searched through.
+        //
+        REBOOL linear = LOGICAL(
+            i <= MAX_LINEAR_SET
+            && (
+                NOT(flags & SOP_FLAG_CHECK)
+                || VAL_LEN_AT(val2) <= MAX_LINEAR_SET
+            )
+        );
+        REBCNT ret_hashes[MAX_LINEAR_SET];
+        REBCNT ret_num = 0;
+        REBCNT check_hashes[MAX_LINEAR_SET];
+        REBCNT check_num = 0;
+
+        // UNIQUE of a block that has a hash index uses that instead.
+        //
+        REBOOL unique_indexed = LOGICAL(
+            flags == SOP_NONE
+            && GET_SER_INFO(VAL_ARRAY(val1), ARRAY_INFO_HASHED)
+        );
+
+        hret = (linear || unique_indexed) ? NULL : Make_Hash_Sequence(i);
 
         do {
             REBARR *array1 = VAL_ARRAY(val1); // val1 and val2 swapped 2nd pass!
 
+            // With the index, UNIQUE keeps the records which are the first
+            // ones in the block to match their keys.
+            //
+            REBSER *index = unique_indexed ? Get_Hash_Index(array1) : NULL;
+
             // Check what is in series1 but not in series2
             //
-            if (flags & SOP_FLAG_CHECK)
-                hser = Hash_Block(val2, skip, cased);
+            REBOOL indexed = FALSE;
+            if (flags & SOP_FLAG_CHECK) {
+                if (GET_SER_INFO(VAL_ARRAY(val2), ARRAY_INFO_HASHED)) {
+                    if (VAL_LEN_AT(val2) % skip != 0)
+                        fail (Error_Block_Skip_Wrong_Raw());
+                    hser = Get_Hash_Index(VAL_ARRAY(val2));
+                    indexed = TRUE;
+                }
+                else if (linear)
+                    check_num = Hash_Keys(check_hashes, val2, skip);
+                else
+                    hser = Hash_Block(val2, skip);
+            }
 
             // Iterate over first series
             //
             i = VAL_INDEX(val1);
             for (; i < ARR_LEN(array1); i += skip) {
                 RELVAL *item = ARR_AT(array1, i);
+
+                if (index != NULL) {
+                    if (
+                        i == Find_Key_Indexed(
+                            array1, index, item, VAL_INDEX(val1), skip, cased
+                        )
+                    ){
+                        REBCNT n;
+                        for (n = 0; n < skip; ++n)
+                            Append_Value_Core(
+                                ARR(buffer), item + n, VAL_SPECIFIER(val1)
+                            );
+                    }
+                    continue;
+                }
+
+                REBCNT hash = linear ? Hash_Value(item) : 0;
+
                 if (flags & SOP_FLAG_CHECK) {
-                    h = Find_Key_Hashed(
-                        VAL_ARRAY(val2),
-                        hser,
-                        item,
-                        VAL_SPECIFIER(val1),
-                        skip,
-                        cased,
-                        1
-                    );
-                    h = (h >= 0);
+                    if (indexed)
+                        h = (NOT_FOUND != Find_Key_Indexed(
+                            VAL_ARRAY(val2),
+                            hser,
+                            item,
+                            VAL_INDEX(val2),
+                            skip,
+                            cased
+                        ));
+                    else if (linear)
+                        h = Find_Key_Linear(
+                            VAL_ARRAY_AT(val2),
+                            check_hashes,
+                            check_num,
+                            skip,
+                            item,
+                            hash,
+                            cased
+                        );
+                    else
+                        h = (0 != Find_Key_Hashed(
+                            VAL_ARRAY(val2),
+                            hser,
+                            item,
+                            VAL_SPECIFIER(val1),
+                            skip,
+                            cased,
+                            FALSE
+                        ));
                     if (flags & SOP_FLAG_INVERT) h = !h;
                 }
-                if (h) {
+                if (!h)
+                    continue;
+
+                if (linear) {
+                    if (!Find_Key_Linear(
+                        ARR_HEAD(ARR(buffer)),
+                        ret_hashes,
+                        ret_num,
+                        skip,
+                        item,
+                        hash,
+                        cased
+                    )){
+                        ret_hashes[ret_num++] = hash;
+
+                        REBCNT n;
+                        for (n = 0; n < skip; ++n)
+                            Append_Value_Core(
+                                ARR(buffer), item + n, VAL_SPECIFIER(val1)
+                            );
+                    }
+                }
+                else {
                     Find_Key_Hashed(
                         ARR(buffer),
                         hret,
@@ -146,7 +290,7 @@ static REBSER *Make_Set_Operation_Series(
                         VAL_SPECIFIER(val1),
                         skip,
                         cased,
-                        2
+                        TRUE
                     );
                 }
             }
@@ -161,7 +305,7 @@ static REBSER *Make_Set_Operation_Series(
                 fail (Error_Block_Skip_Wrong_Raw());
             }
 
-            if (flags & SOP_FLAG_CHECK)
+            if ((flags & SOP_FLAG_CHECK) && NOT(indexed) && NOT(linear))
                 Free_Series(hser);
 
             if (!first_pass) break;
@@ -532,3 +676,55 @@ REBNATIVE(unique)
 
     return R_OUT;
 }
+
+
+//
+//  hash-index: native [
+//
+//  {Keep a hash index of a block, for faster FIND, SELECT and set operations}
+//
+//      return: [any-array!]
+//      block [any-array!]
+//      /off
+//          "Stop keeping the index"
+//  ]
+//
+// The index is kept up to date as values are appended to the block, and built
+// again the first time it is needed after other changes to the block.  The
+// strings and binaries in the block can be changed without it knowing, so
+// they aren't in the index, and are looked for by going through the block.
+// Blocks that were loaded from source can't be indexed, only copies of them.
+//
+REBNATIVE(hash_index)
+{
+    INCLUDE_PARAMS_OF_HASH_INDEX;
+
+    REBARR *a = VAL_ARRAY(ARG(block));
+
+    if (ANY_SER_FLAGS(
+        a, ARRAY_FLAG_VARLIST | ARRAY_FLAG_PARAMLIST | ARRAY_FLAG_PAIRLIST
+    )){
+        fail (ARG(block));
+    }
+
+    if (REF(off)) {
+        if (GET_SER_INFO(a, ARRAY_INFO_HASHED)) {
+            CLEAR_SER_INFO(a, ARRAY_INFO_HASHED);
+            SER(a)->link.hashlist = NULL;
+        }
+    }
+    else if (NOT_SER_INFO(a, ARRAY_INFO_HASHED)) {
+        //
+        // The index would go in the ->link field, where a block that was
+        // loaded keeps the file it came from.  A COPY of it doesn't have that.
+        //
+        if (GET_SER_FLAG(a, SERIES_FLAG_FILE_LINE))
+            fail ("HASH-INDEX can't index a loaded block, index a COPY of it");
+
+        SER(a)->link.hashlist = NULL; // built when first needed
+        SET_SER_INFO(a, ARRAY_INFO_HASHED);
+    }
+
+    Move_Value(D_OUT, ARG(block));
+    return R_OUT;
+}
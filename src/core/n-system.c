@@ -199,6 +199,8 @@ REBNATIVE(recycle)
 //          "High resolution time difference from start"
 //      /evals
 //          "Number of values evaluated by interpreter"
+//      /recycle
+//          "Garbage collector statistics object (pause times)"
 //      /dump-series
 //          "Dump all series in pool"
 //      pool-id [integer!]
@@ -221,6 +223,58 @@ REBNATIVE(stats)
         return R_OUT;
     }
 
+    if (REF(recycle)) {
+        //
+        // See %sysobj.r for `recycle-stats:` object template
+        //
+        REBVAL *example = Get_System(SYS_STANDARD, STD_RECYCLE_STATS);
+        REBCTX *gc = Copy_Context_Shallow(VAL_CONTEXT(example));
+
+        Init_Integer(
+            CTX_VAR(gc, STD_RECYCLE_STATS_RECYCLES), GC_Stats.Recycles
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_RECYCLE_STATS_PAUSE_LAST),
+            GC_Stats.Pause_Last * 1000
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_RECYCLE_STATS_PAUSE_MAX),
+            GC_Stats.Pause_Max * 1000
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_RECYCLE_STATS_PAUSE_TOTAL),
+            GC_Stats.Pause_Total * 1000
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_RECYCLE_STATS_MARK_LAST),
+            GC_Stats.Mark_Last * 1000
+        );
+        Init_Time_Nanoseconds(
+            CTX_VAR(gc, STD_RECYCLE_STATS_SWEEP_LAST),
+            GC_Stats.Sweep_Last * 1000
+        );
+
+        REBCNT managed = GC_Stats.Swept_Last + GC_Stats.Survived_Last;
+        if (managed == 0)
+            Init_Blank(CTX_VAR(gc, STD_RECYCLE_STATS_SURVIVAL));
+        else
+            Init_Percent(
+                CTX_VAR(gc, STD_RECYCLE_STATS_SURVIVAL),
+                cast(REBDEC, GC_Stats.Survived_Last) / managed
+            );
+        Init_Integer(
+            CTX_VAR(gc, STD_RECYCLE_STATS_LIVE_BYTES), GC_Stats.Live_Bytes
+        );
+        Init_Integer(CTX_VAR(gc, STD_RECYCLE_STATS_BALLAST), GC_Ballast);
+        Init_Integer(
+            CTX_VAR(gc, STD_RECYCLE_STATS_RELEASED), GC_Stats.Released_Bytes
+        );
+
+        MANAGE_ARRAY(CTX_VARLIST(gc));
+        Init_Object(D_OUT, gc);
+        return R_OUT;
+    }
+
 #ifdef NDEBUG
     UNUSED(REF(show));
     UNUSED(REF(profile));
@@ -230,37 +284,68 @@ REBNATIVE(stats)
     fail (Error_Debug_Only_Raw());
 #else
     if (REF(profile)) {
-        Move_Value(D_OUT, Get_System(SYS_STANDARD, STD_STATS));
-        if (IS_OBJECT(D_OUT)) {
-            REBVAL *stats = VAL_CONTEXT_VAR(D_OUT, 1);
-
-            VAL_RESET_HEADER(stats, REB_TIME);
-            VAL_NANO(stats) = OS_DELTA_TIME(PG_Boot_Time, 0) * 1000;
-            stats++;
-            Init_Integer(stats, Eval_Cycles + Eval_Dose - Eval_Count);
-            stats++;
-            Init_Integer(stats, 0); // no such thing as natives, only functions
-
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Made);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Freed);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Expanded);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Series_Memory);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Recycle_Series_Total);
-
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Blocks);
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Objects);
-
-            stats++;
-            Init_Integer(stats, PG_Reb_Stats->Recycle_Counter);
-        }
-
+        //
+        // See %sysobj.r for `stats:` object template
+        //
+        REBVAL *example = Get_System(SYS_STANDARD, STD_STATS);
+        REBCTX *stats = Copy_Context_Shallow(VAL_CONTEXT(example));
+
+        Init_Time_Nanoseconds(
+            CTX_VAR(stats, STD_STATS_TIMER),
+            OS_DELTA_TIME(PG_Boot_Time, 0) * 1000
+        );
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_EVALS),
+            Eval_Cycles + Eval_Dose - Eval_Count
+        );
+
+        // no such thing as natives, only functions (and calls aren't counted)
+        //
+        Init_Integer(CTX_VAR(stats, STD_STATS_EVAL_NATIVES), 0);
+        Init_Integer(CTX_VAR(stats, STD_STATS_EVAL_FUNCTIONS), 0);
+
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_SERIES_MADE), PG_Reb_Stats->Series_Made
+        );
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_SERIES_FREED),
+            PG_Reb_Stats->Series_Freed
+        );
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_SERIES_EXPANDED),
+            PG_Reb_Stats->Series_Expanded
+        );
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_SERIES_BYTES),
+            PG_Reb_Stats->Series_Memory
+        );
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_SERIES_RECYCLED),
+            PG_Reb_Stats->Recycle_Series_Total
+        );
+
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_MADE_BLOCKS), PG_Reb_Stats->Blocks
+        );
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_MADE_OBJECTS), PG_Reb_Stats->Objects
+        );
+
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_RECYCLES), PG_Reb_Stats->Recycle_Counter
+        );
+
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_WORD_FETCH_HITS),
+            PG_Reb_Stats->Word_Fetch_Hits
+        );
+        Init_Integer(
+            CTX_VAR(stats, STD_STATS_WORD_FETCH_MISSES),
+            PG_Reb_Stats->Word_Fetch_Misses
+        );
+
+        MANAGE_ARRAY(CTX_VARLIST(stats));
+        Init_Object(D_OUT, stats);
         return R_OUT;
     }
 
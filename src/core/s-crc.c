@@ -134,39 +134,106 @@ REBINT Compute_CRC(REBYTE *str, REBCNT len)
 }
 
 
+// Hash_Word() works on eight bytes of the spelling at a time.  The bytes are
+// gathered into a 64-bit word least significant byte first, so that a word
+// loaded straight from memory agrees with one assembled a byte at a time.
+//
+#define WORD_HASH_MULTIPLIER U64_C(0x9E3779B97F4A7C15) // 2^64 / golden ratio
+#define ASCII_HIGH_BITS U64_C(0x8080808080808080)
+
+#ifdef ENDIAN_BIG
+    #define HASH_BYTE_SHIFT(n) (56 - 8 * (n))
+#else
+    #define HASH_BYTE_SHIFT(n) (8 * (n))
+#endif
+
+inline static REBU64 Mix_Word_Hash(REBU64 hash, REBU64 chunk) {
+    hash = (hash ^ chunk) * WORD_HASH_MULTIPLIER;
+    return hash ^ (hash >> 29);
+}
+
+// Lowercase eight ASCII bytes in a register.  Adding 0x3F to a byte that has
+// no high bit sets its high bit if it is above 'A' - 1, and adding 0x25 sets
+// it if it is above 'Z'.  Bytes where only the first sum overflowed are the
+// uppercase letters, which get the 0x20 bit added in.
+//
+inline static REBU64 Lower_Ascii_Chunk(REBU64 chunk) {
+    REBU64 above_at = chunk + U64_C(0x3F3F3F3F3F3F3F3F);
+    REBU64 above_z = chunk + U64_C(0x2525252525252525);
+    return chunk | ((above_at & ~above_z & ASCII_HIGH_BITS) >> 2);
+}
+
+
 //
 //  Hash_Word: C
 //
 // Return a case insensitive hash value for the string.
 //
+// The hash is of the UTF-8 bytes of the lowercased spelling, so spellings
+// that are equal under Compare_UTF8() always hash the same.  Runs of ASCII
+// are lowercased and mixed in eight bytes at a time, with other characters
+// decoded and lowercased one at a time.
+//
 REBINT Hash_Word(const REBYTE *str, REBCNT len)
 {
-    REBINT hash =
-        cast(REBINT, len) + cast(REBINT, cast(REBYTE, LO_CASE(*str)));
-
-    for (; len > 0; str++, len--) {
-        REBUNI n = *str;
+    REBU64 hash = 0;
+    REBU64 chunk = 0;
+    REBCNT fill = 0; // bytes gathered into chunk
+
+    while (len > 0) {
+        if (fill == 0 && len >= 8) {
+            REBU64 word;
+            memcpy(&word, str, 8); // may be unaligned
+            if ((word & ASCII_HIGH_BITS) == 0) {
+                hash = Mix_Word_Hash(hash, Lower_Ascii_Chunk(word));
+                str += 8;
+                len -= 8;
+                continue;
+            }
+        }
 
-        if (n >= 0x80) {
-            str = Back_Scan_UTF8_Char(&n, str, &len);
+        REBUNI c = *str;
+        if (c >= 0x80) {
+            str = Back_Scan_UTF8_Char(&c, str, &len);
             assert(str); // UTF8 should have already been verified good
         }
+        ++str;
+        --len;
 
-        // Optimize `n = cast(REBYTE, LO_CASE(n))` (drop upper 8 bits)
-        // !!! Is this actually faster?
-        if (n < UNICODE_CASES)
-            n = cast(REBYTE, LO_CASE(n));
+        if (c < UNICODE_CASES)
+            c = LO_CASE(c);
+
+        REBYTE encoded[8];
+        REBCNT size;
+        if (c < 0x80) {
+            encoded[0] = cast(REBYTE, c);
+            size = 1;
+        }
         else
-            n = cast(REBYTE, n);
+            size = Encode_UTF8_Char(encoded, c);
+
+        REBCNT n;
+        for (n = 0; n < size; ++n) {
+            chunk |= cast(REBU64, encoded[n]) << HASH_BYTE_SHIFT(fill);
+            if (++fill == 8) {
+                hash = Mix_Word_Hash(hash, chunk);
+                chunk = 0;
+                fill = 0;
+            }
+        }
+    }
 
-        n = cast(REBYTE, (hash >> CRCSHIFTS) ^ n);
+    if (fill != 0)
+        hash = Mix_Word_Hash(hash, chunk);
 
-        // Left shift math must use unsigned to avoid undefined behavior
-        // http://stackoverflow.com/q/3784996/211160
-        hash = cast(REBINT, MASK_CRC(cast(REBCNT, hash) << 8) ^ CRC_Table[n]);
-    }
+    // Final avalanche (from MurmurHash3), so the low bits that pick a slot
+    // in the power-of-2 sized symbol table depend on all of the input.
+    //
+    hash ^= hash >> 33;
+    hash *= U64_C(0xFF51AFD7ED558CCD);
+    hash ^= hash >> 33;
 
-    return hash;
+    return cast(REBINT, cast(REBCNT, hash));
 }
 
 static u32 *crc32_table = 0;
@@ -374,20 +441,65 @@ REBCNT Hash_Value(const RELVAL *v)
 }
 
 
+//
+//  Hash_Any_Word: C
+//
+// The hash Hash_Value() gives a word of the given kind with this spelling.
+//
+REBCNT Hash_Any_Word(REBSTR *spelling, enum Reb_Kind kind)
+{
+    assert(ANY_WORD_KIND(kind));
+    return Hash_Word(STR_HEAD(spelling), STR_NUM_BYTES(spelling))
+        ^ crc32_table[kind];
+}
+
+
+//
+//  Is_Value_Hashable: C
+//
+// Tells whether Hash_Value() would hash the value, as opposed to failing.
+//
+REBOOL Is_Value_Hashable(const RELVAL *v)
+{
+    switch (VAL_TYPE(v)) {
+    case REB_MAX_VOID:
+    case REB_BITSET:
+    case REB_IMAGE:
+    case REB_VECTOR:
+    case REB_TYPESET:
+    case REB_GOB:
+    case REB_EVENT:
+    case REB_HANDLE:
+    case REB_STRUCT:
+    case REB_LIBRARY:
+        return FALSE;
+
+    default:
+        return TRUE;
+    }
+}
+
+
 //
 //  Make_Hash_Sequence: C
 //
+// Make an empty hashlist for `len` keys.  Its size is a power of 2, at least
+// twice the number of keys, so that it is never more than half full.
+//
 REBSER *Make_Hash_Sequence(REBCNT len)
 {
-    REBCNT n = Get_Hash_Prime(len * 2); // best when 2X # of keys
-    if (n == 0) {
+    if (len > MAX_I32 / 2) {
         DECLARE_LOCAL (temp);
         Init_Integer(temp, len);
 
         fail (Error_Size_Limit_Raw(temp));
     }
 
-    REBSER *ser = Make_Series(n + 1, sizeof(REBCNT));
+    REBCNT n = 4;
+    while (n < len * 2)
+        n *= 2;
+
+    REBSER *ser = Make_Series(n + 1, sizeof(struct Reb_Hash_Slot));
     Clear_Series(ser);
     SET_SERIES_LEN(ser, n);
 
@@ -424,17 +536,14 @@ void Init_Map(REBVAL *out, REBMAP *map)
 //
 // Note: hash array contents (indexes) are 1-based!
 //
-REBSER *Hash_Block(const REBVAL *block, REBCNT skip, REBOOL cased)
+REBSER *Hash_Block(const REBVAL *block, REBCNT skip)
 {
     REBCNT n;
     REBSER *hashlist;
-    REBCNT *hashes;
-    REBARR *array = VAL_ARRAY(block);
     RELVAL *value;
 
     // Create the hash array (integer indexes):
     hashlist = Make_Hash_Sequence(VAL_LEN_AT(block));
-    hashes = SER_HEAD(REBCNT, hashlist);
 
     value = VAL_ARRAY_AT(block);
     if (IS_END(value))
@@ -444,10 +553,9 @@ REBSER *Hash_Block(const REBVAL *block, REBCNT skip, REBOOL cased)
     while (TRUE) {
         REBCNT skip_index = skip;
 
-        REBCNT hash = Find_Key_Hashed(
-            array, hashlist, value, VAL_SPECIFIER(block), 1, cased, 0
-        );
-        hashes[hash] = (n / skip) + 1;
+        // Duplicates are all added, as lookups only test for presence.
+        //
+        Insert_Key_Hashed(hashlist, value, (n / skip) + 1);
 
         while (skip_index != 0) {
             value++;
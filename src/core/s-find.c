@@ -269,6 +269,23 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBCNT l2)
     REBCNT l1 = LEN_BYTES(s1);
     REBINT result = 0;
 
+    // Interning mostly compares a spelling against itself, so first skip any
+    // identical ASCII, eight bytes at a time.  (The first chunk that differs
+    // or has a non-ASCII byte is left for the loop below to rank.)
+    //
+    while (l1 >= 8 && l2 >= 8) {
+        REBU64 w1;
+        REBU64 w2;
+        memcpy(&w1, s1, 8); // may be unaligned
+        memcpy(&w2, s2, 8);
+        if (w1 != w2 || (w1 & U64_C(0x8080808080808080)) != 0)
+            break;
+        s1 += 8;
+        s2 += 8;
+        l1 -= 8;
+        l2 -= 8;
+    }
+
     for (; l1 > 0 && l2 > 0; s1++, s2++, l1--, l2--) {
         c1 = *s1;
         c2 = *s2;
@@ -294,6 +311,253 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBCNT l2)
 }
 
 
+// Searching forward one position at a time is how FIND and PARSE TO/THRU
+// mostly look for a string, so that case is done by the routines below and
+// not a check of every position.
+//
+// In byte-sized series the first byte of the needle (or both of its cases)
+// is scanned for with memchr(), which the C library does many bytes at a
+// time.  When that keeps stopping on bytes where the needle doesn't match,
+// as it will if the needle starts with a space in text, longer needles are
+// switched over to Boyer-Moore-Horspool.  That looks at the last character
+// of each window, and if the needle can't end there moves the window on by
+// as much as the needle allows.
+//
+// Skip tables are indexed by the low byte of the (folded) character, so
+// they also serve for REBUNI series.  That makes some shifts shorter than
+// they could be, but never too long.
+//
+#define BMH_MIN_LEN 4 // shorter needles don't repay building a skip table
+#define MEMCHR_MAX_MISSES 16 // before looking at how far apart hits are
+#define MEMCHR_MIN_GAP 8 // hits closer than this on average are too dense
+
+
+inline static REBUNI Fold_Char(REBUNI c, REBOOL uncase) {
+    return (uncase && c < UNICODE_CASES) ? LO_CASE(c) : c;
+}
+
+
+inline static REBOOL Bytes_Match(
+    const REBYTE *b1,
+    const REBYTE *b2,
+    REBCNT len,
+    REBOOL uncase
+){
+    if (NOT(uncase))
+        return LOGICAL(memcmp(b1, b2, len) == 0);
+
+    REBCNT n;
+    for (n = 0; n < len; ++n) {
+        if (LO_CASE(b1[n]) != LO_CASE(b2[n]))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+
+//
+//  Find_Bytes_Skipping: C
+//
+// Boyer-Moore-Horspool search for Find_Bytes_Forward().
+//
+static REBCNT Find_Bytes_Skipping(
+    const REBYTE *bp,
+    REBCNT index,
+    REBCNT last,
+    const REBYTE *pat,
+    REBCNT len,
+    REBOOL uncase
+){
+    REBCNT shift[256];
+    REBCNT n;
+    for (n = 0; n < 256; ++n)
+        shift[n] = len;
+    for (n = 0; n < len - 1; ++n)
+        shift[Fold_Char(pat[n], uncase) & 0xFF] = len - 1 - n;
+
+    REBUNI final = Fold_Char(pat[len - 1], uncase);
+
+    while (index <= last) {
+        REBUNI c = Fold_Char(bp[index + len - 1], uncase);
+        if (c == final && Bytes_Match(bp + index, pat, len - 1, uncase))
+            return index;
+        index += shift[c & 0xFF];
+    }
+
+    return NOT_FOUND;
+}
+
+
+// Where the byte `b` is next at or after `cp` and before `ep`, or `ep`.
+//
+inline static const REBYTE *Next_Byte(
+    const REBYTE *cp,
+    const REBYTE *ep,
+    REBYTE b
+){
+    const REBYTE *hit = cast(const REBYTE*, memchr(cp, b, ep - cp));
+    return hit != NULL ? hit : ep;
+}
+
+
+//
+//  Find_Bytes_Forward: C
+//
+// Find a byte string `pat` of length `len` in the bytes at `bp`, starting at
+// positions from `index` up to and including `last`.  Returns the position
+// or NOT_FOUND.
+//
+static REBCNT Find_Bytes_Forward(
+    const REBYTE *bp,
+    REBCNT index,
+    REBCNT last,
+    const REBYTE *pat,
+    REBCNT len,
+    REBOOL uncase
+){
+    assert(len != 0 && index <= last);
+
+    // The bytes which can start a match.  Uncased, that's the lowercase of
+    // the first byte and its uppercase, if it's a byte.  (The lowercase of
+    // the micro sign isn't a byte, and it's not worth scanning for that.)
+    //
+    REBUNI first = Fold_Char(pat[0], uncase);
+    REBUNI other = uncase ? UP_CASE(first) : first;
+    if (other > 0xFF)
+        other = first;
+
+    if (first <= 0xFF) {
+        const REBYTE *cp = bp + index;
+        const REBYTE *ep = bp + last + 1;
+        REBCNT misses = 0;
+
+        // Where each case of the first byte is next (or `ep` if it isn't).
+        // One is only looked for again once the search has passed it, as
+        // scanning ahead for it after every hit of the other case would make
+        // the search quadratic when one of them is rare and the other common.
+        //
+        const REBYTE *next_first = Next_Byte(cp, ep, cast(REBYTE, first));
+        const REBYTE *next_other = (other != first)
+            ? Next_Byte(cp, ep, cast(REBYTE, other))
+            : ep;
+
+        while (TRUE) {
+            const REBYTE *hit = MIN(next_first, next_other);
+            if (hit == ep)
+                return NOT_FOUND;
+
+            if (Bytes_Match(hit + 1, pat + 1, len - 1, uncase))
+                return hit - bp;
+
+            cp = hit + 1;
+            if (cp == ep)
+                return NOT_FOUND;
+
+            if (next_first == hit)
+                next_first = Next_Byte(cp, ep, cast(REBYTE, first));
+            else
+                next_other = Next_Byte(cp, ep, cast(REBYTE, other));
+
+            // If the hits are coming too close together, Boyer-Moore-Horspool
+            // should do better from here on.
+            //
+            if (
+                len >= BMH_MIN_LEN
+                && ++misses > MEMCHR_MAX_MISSES
+                && cast(REBCNT, cp - (bp + index)) < misses * MEMCHR_MIN_GAP
+            ){
+                index = cp - bp;
+                break;
+            }
+        }
+    }
+
+    if (len >= BMH_MIN_LEN)
+        return Find_Bytes_Skipping(bp, index, last, pat, len, uncase);
+
+    for (; index <= last; ++index) {
+        if (
+            Fold_Char(bp[index], uncase) == first
+            && Bytes_Match(bp + index + 1, pat + 1, len - 1, uncase)
+        ){
+            return index;
+        }
+    }
+    return NOT_FOUND;
+}
+
+
+//
+//  Find_Chars_Forward: C
+//
+// Find `len` characters of `ser2` from `index2` in `ser1`, starting at
+// positions from `index` up to and including `last`.  Either series may be
+// byte-sized or REBUNI-sized.  Returns the position or NOT_FOUND.
+//
+static REBCNT Find_Chars_Forward(
+    REBSER *ser1,
+    REBCNT index,
+    REBCNT last,
+    REBSER *ser2,
+    REBCNT index2,
+    REBCNT len,
+    REBOOL uncase
+){
+    REBCNT n;
+
+    assert(len != 0 && index <= last);
+
+    if (len < BMH_MIN_LEN) {
+        REBUNI first = Fold_Char(GET_ANY_CHAR(ser2, index2), uncase);
+        for (; index <= last; ++index) {
+            if (Fold_Char(GET_ANY_CHAR(ser1, index), uncase) != first)
+                continue;
+            for (n = 1; n < len; ++n) {
+                if (
+                    Fold_Char(GET_ANY_CHAR(ser1, index + n), uncase)
+                    != Fold_Char(GET_ANY_CHAR(ser2, index2 + n), uncase)
+                ){
+                    break;
+                }
+            }
+            if (n == len)
+                return index;
+        }
+        return NOT_FOUND;
+    }
+
+    REBCNT shift[256];
+    for (n = 0; n < 256; ++n)
+        shift[n] = len;
+    for (n = 0; n < len - 1; ++n) {
+        REBUNI c = Fold_Char(GET_ANY_CHAR(ser2, index2 + n), uncase);
+        shift[c & 0xFF] = len - 1 - n;
+    }
+
+    REBUNI final = Fold_Char(GET_ANY_CHAR(ser2, index2 + len - 1), uncase);
+
+    while (index <= last) {
+        REBUNI c = Fold_Char(GET_ANY_CHAR(ser1, index + len - 1), uncase);
+
+        if (c == final) {
+            for (n = 0; n < len - 1; ++n) {
+                if (
+                    Fold_Char(GET_ANY_CHAR(ser1, index + n), uncase)
+                    != Fold_Char(GET_ANY_CHAR(ser2, index2 + n), uncase)
+                ){
+                    break;
+                }
+            }
+            if (n == len - 1)
+                return index;
+        }
+        index += shift[c & 0xFF];
+    }
+
+    return NOT_FOUND;
+}
+
+
 //
 //  Find_Byte_Str: C
 //
@@ -309,47 +573,28 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBCNT l2)
 REBCNT Find_Byte_Str(REBSER *series, REBCNT index, REBYTE *b2, REBCNT l2, REBOOL uncase, REBOOL match)
 {
     REBYTE *b1;
-    REBYTE *e1;
-    REBCNT l1;
-    REBYTE c;
     REBCNT n;
 
     // The pattern empty or is longer than the target:
     if (l2 == 0 || (l2 + index) > SER_LEN(series)) return NOT_FOUND;
 
-    b1 = BIN_AT(series, index);
-    l1 = SER_LEN(series) - index;
-
-    e1 = b1 + (match ? 1 : l1 - (l2 - 1));
+    if (NOT(match)) {
+        return Find_Bytes_Forward(
+            BIN_HEAD(series), index, SER_LEN(series) - l2, b2, l2, uncase
+        );
+    }
 
-    c = *b2; // first char
+    b1 = BIN_AT(series, index);
 
     if (!uncase) {
-
-        while (b1 != e1) {
-            if (*b1 == c) { // matched first char
-                for (n = 1; n < l2; n++) {
-                    if (b1[n] != b2[n]) break;
-                }
-                if (n == l2) return (b1 - BIN_HEAD(series));
-            }
-            b1++;
-        }
-
-    } else {
-
-        c = (REBYTE)LO_CASE(c); // OK! (never > 255)
-
-        while (b1 != e1) {
-            if (LO_CASE(*b1) == c) { // matched first char
-                for (n = 1; n < l2; n++) {
-                    if (LO_CASE(b1[n]) != LO_CASE(b2[n])) break;
-                }
-                if (n == l2) return (b1 - BIN_HEAD(series));
-            }
-            b1++;
+        if (memcmp(b1, b2, l2) == 0)
+            return index;
+    }
+    else {
+        for (n = 0; n < l2; n++) {
+            if (LO_CASE(b1[n]) != LO_CASE(b2[n])) break;
         }
-
+        if (n == l2) return index;
     }
 
     return NOT_FOUND;
@@ -375,6 +620,31 @@ REBCNT Find_Str_Str(REBSER *ser1, REBCNT head, REBCNT index, REBCNT tail, REBINT
     REBCNT n = 0;
     REBOOL uncase = NOT(flags & AM_FIND_CASE); // case insenstive
 
+    if (skip == 1 && NOT(flags & AM_FIND_MATCH) && len != 0) {
+        //
+        // A match may start before `tail` and run on past it, but not past
+        // the end of the series.
+        //
+        assert(tail <= SER_LEN(ser1));
+        if (index < head || index >= tail || len > SER_LEN(ser1) - index)
+            return NOT_FOUND;
+
+        REBCNT last = MIN(tail - 1, SER_LEN(ser1) - len);
+
+        if (BYTE_SIZE(ser1) && BYTE_SIZE(ser2))
+            index = Find_Bytes_Forward(
+                BIN_HEAD(ser1), index, last, BIN_AT(ser2, index2), len, uncase
+            );
+        else
+            index = Find_Chars_Forward(
+                ser1, index, last, ser2, index2, len, uncase
+            );
+
+        if (index != NOT_FOUND && (flags & AM_FIND_TAIL))
+            return index + len;
+        return index;
+    }
+
     c2 = GET_ANY_CHAR(ser2, index2); // starting char
     if (uncase && c2 < UNICODE_CASES) c2 = LO_CASE(c2);
 
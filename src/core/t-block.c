@@ -229,6 +229,35 @@ void TO_Array(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg) {
 }
 
 
+// Searches of fewer values than this are done without a block's hash index.
+//
+#define MIN_INDEXED_FIND 16
+
+
+//
+//  Is_Indexed_Find_Target: C
+//
+// Tells whether a FIND of the value can be looked up in a hash index.
+//
+static REBOOL Is_Indexed_Find_Target(const RELVAL *target)
+{
+    switch (VAL_TYPE(target)) {
+    case REB_WORD:
+    case REB_SET_WORD:
+    case REB_GET_WORD:
+    case REB_LIT_WORD:
+    case REB_REFINEMENT:
+    case REB_ISSUE:
+    case REB_CHAR:
+    case REB_LOGIC:
+        return TRUE;
+
+    default:
+        return FALSE;
+    }
+}
+
+
 //
 //  Find_In_Array: C
 //
@@ -246,6 +275,31 @@ REBCNT Find_In_Array(
 ){
     REBCNT start = index;
 
+    // An array with a hash index (see HASH-INDEX) can have forward searches
+    // that aren't too short looked up in the index.  But only for targets
+    // whose FIND equality is the same as equality of their hashes (e.g. not
+    // numbers, where 1 is found by 1.0 and decimals are compared loosely),
+    // and which can be in the index (not strings, see Get_Hash_Index()).
+    //
+    if (
+        GET_SER_INFO(array, ARRAY_INFO_HASHED)
+        && NOT(flags & (AM_FIND_REVERSE | AM_FIND_LAST | AM_FIND_MATCH))
+        && skip > 0
+        && index < end
+        && end - index >= MIN_INDEXED_FIND
+        && Is_Indexed_Find_Target(target)
+    ){
+        REBCNT n = Find_Value_Indexed(
+            array,
+            Get_Hash_Index(array),
+            target,
+            index,
+            skip,
+            LOGICAL(flags & AM_FIND_CASE)
+        );
+        return n < end ? n : NOT_FOUND;
+    }
+
     if (flags & (AM_FIND_REVERSE | AM_FIND_LAST)) {
         skip = -1;
         start = 0;
@@ -433,6 +487,237 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 }
 
 
+// Comparators for when the keys being sorted are all of one type, which can
+// go straight to their payloads instead of switching on types in Cmp_Value().
+// They must give the same order Cmp_Value() would.
+
+//
+//  Compare_Integer_Keys: C
+//
+static int Compare_Integer_Keys(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    if (flags->reverse) {
+        const void *temp = v1;
+        v1 = v2;
+        v2 = temp;
+    }
+
+    REBI64 i1 = VAL_INT64(cast(const RELVAL*, v1) + flags->offset);
+    REBI64 i2 = VAL_INT64(cast(const RELVAL*, v2) + flags->offset);
+    return (i1 > i2) - (i1 < i2); // subtracting could overflow
+}
+
+
+//
+//  Compare_Decimal_Keys: C
+//
+static int Compare_Decimal_Keys(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    if (flags->reverse) {
+        const void *temp = v1;
+        v1 = v2;
+        v2 = temp;
+    }
+
+    REBDEC d1 = VAL_DECIMAL(cast(const RELVAL*, v1) + flags->offset);
+    REBDEC d2 = VAL_DECIMAL(cast(const RELVAL*, v2) + flags->offset);
+    if (Eq_Decimal(d1, d2)) // tolerant, as in Cmp_Value()
+        return 0;
+    return d1 < d2 ? -1 : 1;
+}
+
+
+//
+//  Compare_Word_Keys: C
+//
+static int Compare_Word_Keys(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    if (flags->reverse) {
+        const void *temp = v1;
+        v1 = v2;
+        v2 = temp;
+    }
+
+    const RELVAL *w1 = cast(const RELVAL*, v1) + flags->offset;
+    const RELVAL *w2 = cast(const RELVAL*, v2) + flags->offset;
+    if (VAL_WORD_SPELLING(w1) == VAL_WORD_SPELLING(w2))
+        return 0;
+    return Compare_Word(w1, w2, flags->cased);
+}
+
+
+//
+//  Compare_String_Keys: C
+//
+static int Compare_String_Keys(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+    if (flags->reverse) {
+        const void *temp = v1;
+        v1 = v2;
+        v2 = temp;
+    }
+
+    return Compare_String_Vals(
+        cast(const RELVAL*, v1) + flags->offset,
+        cast(const RELVAL*, v2) + flags->offset,
+        NOT(flags->cased)
+    );
+}
+
+
+//
+//  Homogeneous_Key_Kind: C
+//
+// If the keys of all the records are INTEGER!, DECIMAL!, WORD! or STRING!
+// (and all the same one), return that type.  Otherwise return REB_0.
+//
+static enum Reb_Kind Homogeneous_Key_Kind(
+    const RELVAL *head,
+    REBCNT num,
+    REBCNT skip,
+    REBCNT offset
+){
+    if (offset >= skip)
+        return REB_0;
+
+    enum Reb_Kind kind = VAL_TYPE(head + offset);
+    if (
+        kind != REB_INTEGER
+        && kind != REB_DECIMAL
+        && kind != REB_WORD
+        && kind != REB_STRING
+    ){
+        return REB_0;
+    }
+
+    const RELVAL *key = head + offset + skip;
+    for (--num; num > 0; --num, key += skip) {
+        if (VAL_TYPE(key) != kind)
+            return REB_0;
+    }
+    return kind;
+}
+
+
+// Below this many records, sorting INTEGER! keys with reb_qsort_r() is
+// quicker than setting up a radix sort.
+//
+#define MIN_RADIX_SORT 64
+
+struct radix_item {
+    REBU64 key;
+    REBCNT index; // of the record, from the start of the sort
+};
+
+//
+//  Radix_Sort_Integer_Keys: C
+//
+// Sorts the records of a block whose keys are all INTEGER! by the bytes of
+// their keys, least significant first.  (Flipping the sign bit makes the
+// unsigned order of the keys the signed one, and flipping all of them makes
+// it descending for /REVERSE.)  A byte that is the same in all the keys is
+// skipped, so small integers take only a pass or two.
+//
+// Being stable, this is used whether or not SORT/STABLE was asked for.
+// Returns FALSE if the memory for it wasn't available (or its size doesn't
+// fit in a REBUPT).
+//
+static REBOOL Radix_Sort_Integer_Keys(
+    RELVAL *head,
+    REBCNT num,
+    REBCNT skip,
+    struct sort_flags *flags
+){
+    // Two items for each record (the ones being sorted, and the ones they
+    // are sorted into), then the counts.
+    //
+    REBUPT limit = (~cast(REBUPT, 0) - sizeof(REBCNT) * 256)
+        / (sizeof(struct radix_item) * 2);
+    if (num > limit)
+        return FALSE;
+
+    REBUPT bytes = sizeof(struct radix_item) * 2 * cast(REBUPT, num)
+        + sizeof(REBCNT) * 256;
+    REBYTE *mem = ALLOC_N(REBYTE, bytes);
+    if (mem == NULL)
+        return FALSE;
+
+    struct radix_item *items = cast(struct radix_item*, mem);
+    struct radix_item *sorted = items + num;
+    REBCNT *counts = cast(REBCNT*, sorted + num);
+
+    REBU64 flip = flags->reverse ? ~cast(REBU64, 0) : 0;
+    flip ^= cast(REBU64, 1) << 63;
+
+    REBU64 all_ones = ~cast(REBU64, 0);
+    REBU64 all_zeros = 0;
+
+    REBCNT n;
+    for (n = 0; n < num; ++n) {
+        REBU64 key = cast(REBU64, VAL_INT64(head + n * skip + flags->offset));
+        key ^= flip;
+        items[n].key = key;
+        items[n].index = n;
+        all_ones &= key;
+        all_zeros |= key;
+    }
+
+    // Bits that are 1 in all_ones or 0 in all_zeros are the same in all keys.
+    //
+    REBU64 varies = all_zeros & ~all_ones;
+
+    REBCNT shift;
+    for (shift = 0; shift < 64; shift += 8) {
+        if (((varies >> shift) & 0xFF) == 0)
+            continue;
+
+        memset(counts, 0, sizeof(REBCNT) * 256);
+        for (n = 0; n < num; ++n)
+            ++counts[(items[n].key >> shift) & 0xFF];
+
+        REBCNT total = 0;
+        REBCNT b;
+        for (b = 0; b < 256; ++b) {
+            REBCNT count = counts[b];
+            counts[b] = total;
+            total += count;
+        }
+
+        for (n = 0; n < num; ++n)
+            sorted[counts[(items[n].key >> shift) & 0xFF]++] = items[n];
+
+        struct radix_item *swap = items;
+        items = sorted;
+        sorted = swap;
+    }
+
+    // Lay the records out in order in a copy, and then copy that back.
+    //
+    REBCNT cells = num * skip;
+    RELVAL *copy = ALLOC_N(RELVAL, cells);
+    if (copy == NULL) {
+        FREE_N(REBYTE, bytes, mem);
+        return FALSE;
+    }
+
+    for (n = 0; n < num; ++n)
+        memcpy(
+            copy + n * skip,
+            head + items[n].index * skip,
+            sizeof(RELVAL) * skip
+        );
+    memcpy(head, copy, sizeof(RELVAL) * cells);
+
+    FREE_N(RELVAL, cells, copy);
+    FREE_N(REBYTE, bytes, mem);
+    return TRUE;
+}
+
+
 //
 //  Sort_Block: C
 //
@@ -446,6 +731,10 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 // limit [any-number! any-series!] {Length of series to sort}
 // /all {Compare all fields}
 // /reverse {Reverse sort order}
+// /stable {Keep values that compare equal in the order they were in}
+//
+// Without a /COMPARE function, blocks whose keys are all of one common type
+// use a comparator for that type (or a radix sort, for integers).
 //
 static void Sort_Block(
     REBVAL *block,
@@ -454,7 +743,8 @@ static void Sort_Block(
     REBVAL *compv,
     REBVAL *part,
     REBOOL all,
-    REBOOL rev
+    REBOOL rev,
+    REBOOL stable
 ) {
     struct sort_flags flags;
     flags.cased = ccase;
@@ -491,13 +781,73 @@ static void Sort_Block(
     else
         skip = 1;
 
-    reb_qsort_r(
-        VAL_ARRAY_AT(block),
-        len / skip,
+    RELVAL *head = VAL_ARRAY_AT(block);
+    REBCNT num = len / skip;
+
+    cmp_t *cmp;
+    if (flags.comparator != NULL)
+        cmp = &Compare_Val_Custom;
+    else switch (Homogeneous_Key_Kind(head, num, skip, flags.offset)) {
+    case REB_INTEGER:
+        if (num >= MIN_RADIX_SORT && Radix_Sort_Integer_Keys(
+            head, num, skip, &flags
+        )){
+            return;
+        }
+        cmp = &Compare_Integer_Keys;
+        break;
+
+    case REB_DECIMAL:
+        cmp = &Compare_Decimal_Keys;
+        break;
+
+    case REB_WORD:
+        cmp = &Compare_Word_Keys;
+        break;
+
+    case REB_STRING:
+        cmp = &Compare_String_Keys;
+        break;
+
+    default:
+        cmp = &Compare_Val;
+    }
+
+    // Only the comparators for one type of key are known not to allocate or
+    // fail, so only they can be used by more than one thread at once.
+    //
+    REBOOL can_fail = LOGICAL(
+        flags.comparator != NULL || cmp == &Compare_Val
+    );
+    REBCNT threads = can_fail ? 1 : Sort_Threads(num);
+
+    if (NOT(stable) && threads == 1) {
+        reb_qsort_r(head, num, sizeof(REBVAL) * skip, &flags, cmp);
+        return;
+    }
+
+    // With a comparator that can fail, Merge_Sort() only writes the block
+    // between passes, so if it does the block still has every value in it
+    // once.  The merge buffer is guarded as well in case of a recycle.
+    //
+    REBARR *temp = Make_Array(len);
+    memcpy(ARR_HEAD(temp), head, sizeof(REBVAL) * len);
+    TERM_ARRAY_LEN(temp, len);
+    PUSH_GUARD_ARRAY_CONTENTS(temp);
+
+    Parallel_Merge_Sort(
+        head,
+        ARR_HEAD(temp),
+        num,
         sizeof(REBVAL) * skip,
         &flags,
-        flags.comparator != NULL ? &Compare_Val_Custom : &Compare_Val
+        cmp,
+        can_fail,
+        threads
     );
+
+    DROP_GUARD_ARRAY_CONTENTS(temp);
+    Free_Array(temp);
 }
 
 
@@ -511,6 +861,8 @@ void Shuffle_Block(REBVAL *value, REBOOL secure)
     REBCNT idx = VAL_INDEX(value);
     RELVAL *data = VAL_ARRAY_HEAD(value);
 
+    Invalidate_Array_Indexes(VAL_SERIES(value));
+
     // Rare case where RELVAL bit copying is okay...between spots in the
     // same array.
     //
@@ -552,11 +904,23 @@ REBINT PD_Array(REBPVS *pvs)
         n = Int32(pvs->picker) + VAL_INDEX(pvs->value) - 1;
     }
     else if (IS_WORD(pvs->picker)) {
-        n = Find_Word_In_Array(
-            VAL_ARRAY(pvs->value),
-            VAL_INDEX(pvs->value),
-            VAL_WORD_CANON(pvs->picker)
-        );
+        if (GET_SER_INFO(VAL_ARRAY(pvs->value), ARRAY_INFO_HASHED)) {
+            n = Find_In_Array( // same matching, but can use the hash index
+                VAL_ARRAY(pvs->value),
+                VAL_INDEX(pvs->value),
+                VAL_LEN_HEAD(pvs->value),
+                pvs->picker,
+                1, // length of target
+                0, // flags
+                1 // skip
+            );
+        }
+        else
+            n = Find_Word_In_Array(
+                VAL_ARRAY(pvs->value),
+                VAL_INDEX(pvs->value),
+                VAL_WORD_CANON(pvs->picker)
+            );
         if (cast(REBCNT, n) != NOT_FOUND) n++;
     }
     else if (IS_LOGIC(pvs->picker)) {
@@ -591,8 +955,10 @@ REBINT PD_Array(REBPVS *pvs)
         return PE_USE_STORE;
     }
 
-    if (pvs->opt_setval)
+    if (pvs->opt_setval) {
         FAIL_IF_READ_ONLY_SERIES(VAL_SERIES(pvs->value));
+        Invalidate_Array_Indexes(VAL_SERIES(pvs->value));
+    }
 
     pvs->value_specifier = Derive_Specifier(pvs->value_specifier, pvs->value);
     pvs->value = VAL_ARRAY_AT_HEAD(pvs->value, n);
@@ -807,6 +1173,7 @@ REBTYPE(Array)
 
     case SYM_CLEAR: {
         FAIL_IF_READ_ONLY_ARRAY(array);
+        Invalidate_Array_Indexes(SER(array));
         if (index < VAL_LEN_HEAD(value)) {
             if (index == 0) Reset_Array(array);
             else {
@@ -918,6 +1285,9 @@ REBTYPE(Array)
         FAIL_IF_READ_ONLY_ARRAY(array);
         FAIL_IF_READ_ONLY_ARRAY(VAL_ARRAY(arg));
 
+        Invalidate_Array_Indexes(SER(array));
+        Invalidate_Array_Indexes(SER(VAL_ARRAY(arg)));
+
         if (
             index < VAL_LEN_HEAD(value)
             && VAL_INDEX(arg) < VAL_LEN_HEAD(arg)
@@ -937,6 +1307,7 @@ REBTYPE(Array)
         Partial1(value, D_ARG(3), &len);
 
         FAIL_IF_READ_ONLY_ARRAY(array);
+        Invalidate_Array_Indexes(SER(array));
 
         if (len != 0) {
             //
@@ -963,6 +1334,7 @@ REBTYPE(Array)
         UNUSED(REF(compare)); // checks comparator as void
 
         FAIL_IF_READ_ONLY_ARRAY(array);
+        Invalidate_Array_Indexes(SER(array));
 
         Sort_Block(
             value,
@@ -971,8 +1343,10 @@ REBTYPE(Array)
             ARG(comparator), // (may be void if no /COMPARE)
             ARG(limit), // (may be void if no /PART)
             REF(all),
-            REF(reverse)
+            REF(reverse),
+            REF(stable)
         );
+        Invalidate_Array_Indexes(SER(array)); // in case /COMPARE used it
         Move_Value(D_OUT, value);
         return R_OUT;
     }
@@ -53,222 +53,472 @@ static REBMAP *Make_Map(REBCNT capacity)
 {
     REBARR *pairlist = Make_Array_Core(capacity * 2, ARRAY_FLAG_PAIRLIST);
     SER(pairlist)->link.hashlist = Make_Hash_Sequence(capacity);
+    SER(pairlist)->misc.removed = 0;
 
     return MAP(pairlist);
 }
 
 
+// Hash_Value() results are not well spread in their low bits (an INTEGER!
+// hashes to itself), so they are mixed before the low bits are used to pick
+// a slot in the power-of-2 hashlist.  All but the low 3 bits go through the
+// finalizer of MurmurHash3, and the low 3 bits are only scrambled.  So keys
+// like 1, 2, 3... still land in groups of 8 adjacent slots (8 slots are one
+// 64-byte cache line), while strided keys like 4096, 8192... are spread out.
 //
-//  Find_Key_Hashed: C
+inline static REBCNT Mix_Key_Hash(REBCNT hash) {
+    REBCNT mixed = hash >> 3;
+    mixed ^= mixed >> 16;
+    mixed *= 0x85EBCA6B;
+    mixed ^= mixed >> 13;
+    mixed *= 0xC2B2AE35;
+    mixed ^= mixed >> 16;
+    return (mixed << 3) | ((hash ^ (mixed >> 29)) & 7);
+}
+
+// How many slots past the one its hash maps to an entry has been put.
 //
-// Returns hash index (either the match or the new one).
-// A return of zero is valid (as a hash index);
+#define PROBE_DISTANCE(slot,hash,mask) \
+    (((slot) - ((hash) & (mask))) & (mask))
+
+
 //
-// Wide: width of record (normally 2, a key and a value).
+//  Insert_Hash_Slot: C
 //
-// Modes:
-//     0 - search, return hash if found or not
-//     1 - search, return hash, else return -1 if not
-//     2 - search, return hash, else append value and return -1
+// Add an entry to a hashlist which has at least one unused slot, using
+// "Robin Hood" linear probing: an entry that has probed farther than the one
+// in a slot takes that slot, and the displaced entry continues the search.
+// This keeps all the entries for a hash close to where it maps to, and lets
+// a search stop as soon as it passes an entry closer to its home than it is.
 //
-REBINT Find_Key_Hashed(
-    REBARR *array,
-    REBSER *hashlist,
-    const RELVAL *key, // !!! assumes key is followed by value(s) via ++
-    REBSPC *specifier,
-    REBCNT wide,
-    REBOOL cased,
-    REBYTE mode
-) {
-    REBCNT len = SER_LEN(hashlist);
-    assert(len > 0);
-
-    REBCNT hash = Hash_Value(key);
-
-    // The REBCNT[] hash array size is chosen to try and make a large enough
-    // table relative to the data that collisions will be hopefully not
-    // frequent.  But they may still collide.  The method R3-Alpha chose to
-    // deal with collisions was to have a "skip" amount that will go try
-    // another hash bucket until the searched for key is found or a 0
-    // entry in the hashlist is found.
-    //
-    // Note: if len and skip are co-primes is guaranteed that repeatedly
-    // adding skip (and subtracting len when needed) all positions are
-    // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
-
-    REBCNT skip = hash % (len - 1) + 1;
-
-    hash = hash % len;
-
-    // a 'zombie' is a key with void value, that may be overwritten.  Set to
-    // len to indicate zombie not yet encountered.
-    //
-    REBCNT zombie = len;
+// https://en.wikipedia.org/wiki/Hash_table#Robin_Hood_hashing
+//
+static void Insert_Hash_Slot(REBSER *hashlist, REBCNT hash, REBCNT index)
+{
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1;
+
+    REBCNT slot = hash & mask;
+    REBCNT distance = 0;
+    for (; slots[slot].index != 0; slot = (slot + 1) & mask, ++distance) {
+        REBCNT occupant = PROBE_DISTANCE(slot, slots[slot].hash, mask);
+        if (occupant < distance) {
+            struct Reb_Hash_Slot displaced = slots[slot];
+            slots[slot].hash = hash;
+            slots[slot].index = index;
+            hash = displaced.hash;
+            index = displaced.index;
+            distance = occupant;
+        }
+    }
+    slots[slot].hash = hash;
+    slots[slot].index = index;
+}
 
-    REBCNT uncased = len; // uncased match not yet encountered
 
-    // Scan hash table for match:
+//
+//  Remove_Hash_Slot: C
+//
+// Take an entry out of a hashlist.  The entries after it that aren't in the
+// slot their hash maps to are shifted back by one, so no "deleted" marker is
+// needed to keep searches going past the hole.
+//
+static void Remove_Hash_Slot(REBSER *hashlist, REBCNT slot)
+{
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1;
+
+    REBCNT next = (slot + 1) & mask;
+    while (
+        slots[next].index != 0
+        && PROBE_DISTANCE(next, slots[next].hash, mask) != 0
+    ){
+        slots[slot] = slots[next];
+        slot = next;
+        next = (next + 1) & mask;
+    }
+    slots[slot].index = 0;
+}
 
-    REBCNT *hashes = SER_HEAD(REBCNT, hashlist);
-    REBCNT n;
-    RELVAL *val;
 
+//
+//  Match_Key: C
+//
+// Compare a key to a value the way a lookup in a hashlist does, for a value
+// whose hash is the same as the key's.  Returns 2 if they match exactly, 1
+// if they only match because `cased` is FALSE (they differ in case), and 0
+// if they don't match.
+//
+REBINT Match_Key(const RELVAL *key, const RELVAL *val, REBOOL cased)
+{
     if (ANY_WORD(key)) {
-        while ((n = hashes[hash])) {
-            val = ARR_AT(array, (n - 1) * wide);
-            if (ANY_WORD(val)) {
-                if (VAL_WORD_SPELLING(key) == VAL_WORD_SPELLING(val))
-                    return hash; // exact match
-
-                if (NOT(cased) && uncased == len) // not cased w/no match yet
-                    if (VAL_WORD_CANON(key) == VAL_WORD_CANON(val))
-                        uncased = hash; // indicate uncased match found
-            }
-            else if (wide > 1 && IS_VOID(++val) && zombie == len) {
-                zombie = hash;
-            }
-            hash += skip;
-            if (hash >= len) hash -= len;
+        if (ANY_WORD(val)) {
+            if (VAL_WORD_SPELLING(key) == VAL_WORD_SPELLING(val))
+                return 2; // exact match
+
+            if (NOT(cased) && VAL_WORD_CANON(key) == VAL_WORD_CANON(val))
+                return 1;
         }
     }
     else if (ANY_BINSTR(key)) {
-        while ((n = hashes[hash])) {
-            val = ARR_AT(array, (n - 1) * wide);
-            if (VAL_TYPE(val) == VAL_TYPE(key)) {
-                if (0 == Compare_String_Vals(val, key, FALSE)) return hash;
-                if (
-                    !cased && uncased == len
-                    && 0 == Compare_String_Vals(
-                        val, key, LOGICAL(!IS_BINARY(key))
-                    )
-                ) {
-                    uncased = hash;
-                }
-            }
-            if (wide > 1 && IS_VOID(++val) && zombie == len)  {
-                zombie = hash;
+        if (VAL_TYPE(val) == VAL_TYPE(key)) {
+            if (0 == Compare_String_Vals(val, key, FALSE))
+                return 2;
+
+            if (
+                NOT(cased)
+                && 0 == Compare_String_Vals(val, key, LOGICAL(!IS_BINARY(key)))
+            ){
+                return 1;
             }
-            hash += skip;
-            if (hash >= len) hash -= len;
         }
-    } else {
-        while ((n = hashes[hash])) {
-            val = ARR_AT(array, (n - 1) * wide);
-            if (VAL_TYPE(val) == VAL_TYPE(key)) {
-                if (0 == Cmp_Value(key, val, TRUE)) {
-                    return hash;
-                }
-                if (
-                    !cased && uncased == len
-                    && REB_CHAR == VAL_TYPE(val)
-                    && 0 == Cmp_Value(key, val, FALSE)
-                ) {
-                    uncased = hash;
-                }
+    }
+    else {
+        if (VAL_TYPE(val) == VAL_TYPE(key)) {
+            if (0 == Cmp_Value(key, val, TRUE))
+                return 2;
+
+            if (
+                NOT(cased)
+                && REB_CHAR == VAL_TYPE(val)
+                && 0 == Cmp_Value(key, val, FALSE)
+            ){
+                return 1;
             }
-            if (wide > 1 && IS_VOID(++val) && zombie == len) zombie = hash;
-            hash += skip;
-            if (hash >= len) hash -= len;
         }
     }
 
-    //assert(n == 0);
-    if (!cased && uncased < len) hash = uncased; // uncased< match
-    else if (zombie < len) { // zombie encountered!
-        assert(mode == 0);
-        hash = zombie;
-        n = hashes[hash];
-        // new key overwrite zombie
-        *ARR_AT(array, (n - 1) * wide) = *key;
+    return 0;
+}
+
+
+//
+//  Find_Key_Slot: C
+//
+// Returns the hashlist slot of the record whose key matches, or NOT_FOUND.
+// The `hash` must be the mixed hash of the key.
+//
+// Wide: width of record (normally 2, a key and a value).
+//
+// If not `cased`, an exact match is preferred, but a match that differs only
+// in case will be returned otherwise.
+//
+static REBCNT Find_Key_Slot(
+    REBARR *array,
+    REBSER *hashlist,
+    const RELVAL *key,
+    REBCNT hash,
+    REBCNT wide,
+    REBOOL cased
+) {
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1;
+
+    REBCNT uncased = NOT_FOUND; // uncased match not yet encountered
+
+    // Case-insensitive hashing means any match, cased or not, has the same
+    // hash.  So only records whose stored hash is equal have to be looked
+    // at.  The search ends at an unused slot, or at an entry that is closer
+    // to its home slot than the key would be (it would have been displaced).
+
+    REBCNT slot = hash & mask;
+    REBCNT distance = 0;
+    for (; slots[slot].index != 0; slot = (slot + 1) & mask, ++distance) {
+        if (PROBE_DISTANCE(slot, slots[slot].hash, mask) < distance)
+            break;
+
+        if (slots[slot].hash != hash)
+            continue;
+
+        const RELVAL *val = ARR_AT(array, (slots[slot].index - 1) * wide);
+
+        REBINT match = Match_Key(key, val, cased);
+        if (match == 2)
+            return slot;
+
+        if (match == 1 && uncased == NOT_FOUND)
+            uncased = slot;
     }
-    // Append new value the target series:
-    if (mode > 1) {
-        REBCNT index;
-        const RELVAL *src = key;
-        hashes[hash] = (ARR_LEN(array) / wide) + 1;
+
+    return uncased;
+}
+
+
+//
+//  Find_Key_Hashed: C
+//
+// Returns the 1-based index of the record in the array whose key matches,
+// or 0 if there is none.  If `add` is TRUE and there was no match, `wide`
+// values starting at the key are appended to the array as a new record, and
+// it is added to the hashlist (which must have room for it).
+//
+// Wide: width of record (normally 2, a key and a value).
+//
+REBCNT Find_Key_Hashed(
+    REBARR *array,
+    REBSER *hashlist,
+    const RELVAL *key, // !!! assumes key is followed by value(s) via ++
+    REBSPC *specifier,
+    REBCNT wide,
+    REBOOL cased,
+    REBOOL add
+) {
+    REBCNT hash = Mix_Key_Hash(Hash_Value(key));
+
+    REBCNT slot = Find_Key_Slot(array, hashlist, key, hash, wide, cased);
+    if (slot != NOT_FOUND)
+        return HASH_SLOTS(hashlist)[slot].index;
+
+    if (add) {
+        Insert_Hash_Slot(hashlist, hash, (ARR_LEN(array) / wide) + 1);
 
         // This used to use Append_Values_Len, but that is a REBVAL* interface
         // !!! Should there be an Append_Values_Core which takes RELVAL*?
         //
+        REBCNT index;
+        const RELVAL *src = key;
         for (index = 0; index < wide; ++src, ++index)
             Append_Value_Core(array, src, specifier);
     }
 
-    return (mode > 0) ? NOT_FOUND : hash;
+    return 0;
 }
 
 
 //
-//  Rehash_Map: C
+//  Find_Indexed_Core: C
 //
-// Recompute the entire hash table for a map. Table must be large enough.
+// Search a hash index of all the values in an array (see Get_Hash_Index())
+// for the first value at `start`, `start + skip`, ... which has the given
+// hash (from Hash_Value()) and matches the key.  With `find`, they are
+// compared the way FIND does, and otherwise the way Match_Key() does (where
+// any match counts, whether it differs in case or not).
 //
-static void Rehash_Map(REBMAP *map)
-{
-    REBSER *hashlist = MAP_HASHLIST(map);
+static REBCNT Find_Indexed_Core(
+    REBARR *array,
+    REBSER *hashlist,
+    const RELVAL *key,
+    REBCNT hash,
+    REBCNT start,
+    REBCNT skip,
+    REBOOL cased,
+    REBOOL find
+) {
+    hash = Mix_Key_Hash(hash);
 
-    if (!hashlist) return;
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
+    REBCNT mask = SER_LEN(hashlist) - 1;
 
-    REBCNT *hashes = SER_HEAD(REBCNT, hashlist);
-    REBARR *pairlist = MAP_PAIRLIST(map);
+    REBCNT found = NOT_FOUND;
 
-    REBVAL *key = KNOWN(ARR_HEAD(pairlist));
-    REBCNT n;
+    REBCNT slot = hash & mask;
+    REBCNT distance = 0;
+    for (; slots[slot].index != 0; slot = (slot + 1) & mask, ++distance) {
+        if (PROBE_DISTANCE(slot, slots[slot].hash, mask) < distance)
+            break;
 
-    for (n = 0; n < ARR_LEN(pairlist); n += 2, key += 2) {
-        const REBOOL cased = TRUE; // cased=TRUE is always fine
+        if (slots[slot].hash != hash)
+            continue;
 
-        if (IS_VOID(key + 1)) {
-            //
-            // It's a "zombie", move last key to overwrite it
-            //
-            Move_Value(
-                key, KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 2))
-            );
-            Move_Value(
-                &key[1], KNOWN(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
+        REBCNT n = slots[slot].index - 1;
+        if (n < start || n >= found || (n - start) % skip != 0)
+            continue;
+
+        const RELVAL *val = ARR_AT(array, n);
+
+        REBOOL match;
+        if (NOT(find))
+            match = LOGICAL(Match_Key(key, val, cased) != 0);
+        else if (ANY_WORD(key)) {
+            // (FIND only looks words up by their own kind if it's cased)
+            assert(cased);
+            match = LOGICAL(
+                VAL_TYPE(val) == VAL_TYPE(key)
+                && VAL_WORD_SPELLING(val) == VAL_WORD_SPELLING(key)
             );
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
         }
+        else
+            match = LOGICAL(0 == Cmp_Value(val, key, cased));
 
-        REBCNT hash = Find_Key_Hashed(
-            pairlist, hashlist, key, SPECIFIED, 2, cased, 0
-        );
-        hashes[hash] = n / 2 + 1;
+        if (match)
+            found = n;
+    }
 
-        // discard zombies at end of pairlist
-        //
-        while (IS_VOID(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))) {
-            SET_ARRAY_LEN_NOTERM(pairlist, ARR_LEN(pairlist) - 2);
+    return found;
+}
+
+
+//
+//  Find_Key_Indexed: C
+//
+// Look for a key in an array using its hash index, where the 1-based index
+// in each entry is the position of the value in the array.  Only the values
+// at `start`, `start + skip`, ... are candidates.  Any match counts, whether
+// it differs in case or not.
+//
+// Returns the position of the first of those values that matches, or
+// NOT_FOUND.
+//
+REBCNT Find_Key_Indexed(
+    REBARR *array,
+    REBSER *hashlist,
+    const RELVAL *key,
+    REBCNT start,
+    REBCNT skip,
+    REBOOL cased
+) {
+    // Arrays, strings and binaries aren't in the index (see Get_Hash_Index())
+    // so they are looked for the slow way.
+    //
+    if (ANY_ARRAY(key) || ANY_BINSTR(key)) {
+        REBCNT n;
+        for (n = start; n < ARR_LEN(array); n += skip) {
+            if (Match_Key(key, ARR_AT(array, n), cased) != 0)
+                return n;
         }
+        return NOT_FOUND;
+    }
+
+    return Find_Indexed_Core(
+        array, hashlist, key, Hash_Value(key), start, skip, cased, FALSE
+    );
+}
+
+
+//
+//  Find_Value_Indexed: C
+//
+// Like Find_Key_Indexed(), but the values are compared the way FIND does.
+// Only targets for which that kind of equality implies equal hashes, and
+// which are in the index, may be looked for (words, characters and logics).
+//
+REBCNT Find_Value_Indexed(
+    REBARR *array,
+    REBSER *hashlist,
+    const RELVAL *target,
+    REBCNT start,
+    REBCNT skip,
+    REBOOL cased
+) {
+    if (NOT(ANY_WORD(target)) || cased) {
+        REBCNT hash = Hash_Value(target);
+        return Find_Indexed_Core(
+            array, hashlist, target, hash, start, skip, cased, TRUE
+        );
     }
+
+    // A FIND that isn't cased matches words of any kind with the spelling
+    // in any case.  Each kind has its own hash, so look for each of them.
+    // (Match_Key() compares the canons of words, whatever their kind.)
+    //
+    REBSTR *spelling = VAL_WORD_SPELLING(target);
+
+    REBCNT found = NOT_FOUND;
+    REBCNT kind;
+    for (kind = REB_WORD; kind <= REB_ISSUE; ++kind) {
+        REBCNT n = Find_Indexed_Core(
+            array,
+            hashlist,
+            target,
+            Hash_Any_Word(spelling, cast(enum Reb_Kind, kind)),
+            start,
+            skip,
+            FALSE,
+            FALSE
+        );
+        if (n < found)
+            found = n;
+    }
+    return found;
+}
+
+
+//
+//  Insert_Key_Hashed: C
+//
+// Add a key to a hashlist as the record at a 1-based index, without checking
+// to see if it is already there.  The hashlist must have room for it.
+//
+void Insert_Key_Hashed(REBSER *hashlist, const RELVAL *key, REBCNT index)
+{
+    Insert_Hash_Slot(hashlist, Mix_Key_Hash(Hash_Value(key)), index);
 }
 
 
 //
 //  Expand_Hash: C
 //
-// Expand hash series. Clear it but set its tail.
+// Double the size of a hashlist, moving its entries over using the hashes
+// that are saved with them (so no keys have to be hashed again).
 //
-void Expand_Hash(REBSER *ser)
+void Expand_Hash(REBSER *hashlist)
 {
-    REBINT pnum = Get_Hash_Prime(SER_LEN(ser) + 1);
-    if (pnum == 0) {
+    REBCNT old_size = SER_LEN(hashlist);
+    if (old_size > MAX_I32 / 2) {
         DECLARE_LOCAL (temp);
-        Init_Integer(temp, SER_LEN(ser) + 1);
+        Init_Integer(temp, old_size + 1);
         fail (Error_Size_Limit_Raw(temp));
     }
 
-    assert(NOT_SER_FLAG(ser, SERIES_FLAG_ARRAY));
-    Remake_Series(
-        ser,
-        pnum + 1,
-        SER_WIDE(ser),
-        SERIES_FLAG_POWER_OF_2 // NOT(NODE_FLAG_NODE) => don't keep data
-    );
+    REBSER *bigger = Make_Hash_Sequence(old_size); // 2x for occupancy of 1/2
+    assert(SER_LEN(bigger) == old_size * 2);
+
+    struct Reb_Hash_Slot *slots = HASH_SLOTS(hashlist);
+    REBCNT n;
+    for (n = 0; n < old_size; ++n) {
+        if (slots[n].index != 0)
+            Insert_Hash_Slot(bigger, slots[n].hash, slots[n].index);
+    }
 
-    Clear_Series(ser);
-    SET_SERIES_LEN(ser, pnum);
+    Swap_Series_Content(hashlist, bigger); // hashlist may be managed
+    Free_Series(bigger);
+}
+
+
+//
+//  Rehash_Map: C
+//
+// Build the hash table for a pairlist that was filled in without one, or
+// that has gaps left by removals to close up.  Pairs with void values are
+// taken out, as are pairs whose key is already in the map (with the later
+// value being kept).  The pairs that are left stay in the same order.
+//
+static void Rehash_Map(REBMAP *map)
+{
+    REBSER *hashlist = MAP_HASHLIST(map);
+    REBARR *pairlist = MAP_PAIRLIST(map);
+
+    Clear_Series(hashlist);
+
+    // Pairs are moved down over the ones dropped, keeping their order.
+    //
+    REBCNT to = 0;
+    REBCNT from;
+    for (from = 0; from < ARR_LEN(pairlist); from += 2) {
+        REBVAL *key = KNOWN(ARR_AT(pairlist, from));
+        if (IS_VOID(key + 1))
+            continue;
+
+        REBCNT hash = Mix_Key_Hash(Hash_Value(key));
+        const REBOOL cased = TRUE;
+        REBCNT slot = Find_Key_Slot(pairlist, hashlist, key, hash, 2, cased);
+        if (slot != NOT_FOUND) {
+            REBCNT index = HASH_SLOTS(hashlist)[slot].index;
+            Move_Value(KNOWN(ARR_AT(pairlist, (index - 1) * 2 + 1)), key + 1);
+            continue;
+        }
+
+        if (to != from) {
+            REBVAL *dest = KNOWN(ARR_AT(pairlist, to));
+            Move_Value(dest, key);
+            Move_Value(dest + 1, key + 1);
+        }
+        Insert_Hash_Slot(hashlist, hash, to / 2 + 1);
+        to += 2;
+    }
+    TERM_ARRAY_LEN(pairlist, to);
+
+    SER(pairlist)->misc.removed = 0;
 }
 
 
@@ -276,7 +526,8 @@ void Expand_Hash(REBSER *ser)
 //  Find_Map_Entry: C
 //
 // Try to find the entry in the map. If not found and val isn't void, create
-// the entry and store the key and val.
+// the entry and store the key and val.  If found and val is void, the entry
+// is removed.
 //
 // RETURNS: the index to the VALUE or zero if there is none.
 //
@@ -290,23 +541,15 @@ static REBCNT Find_Map_Entry(
 ) {
     assert(!IS_VOID(key));
 
-    REBSER *hashlist = MAP_HASHLIST(map); // can be null
+    REBSER *hashlist = MAP_HASHLIST(map);
     REBARR *pairlist = MAP_PAIRLIST(map);
 
     assert(hashlist);
 
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_LEN(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
-        Rehash_Map(map);
-    }
+    REBCNT hash = Mix_Key_Hash(Hash_Value(key));
+    REBCNT slot = Find_Key_Slot(pairlist, hashlist, key, hash, 2, cased);
 
-    REBCNT hash = Find_Key_Hashed(
-        pairlist, hashlist, key, key_specifier, 2, cased, 0
-    );
-
-    REBCNT *hashes = SER_HEAD(REBCNT, hashlist);
-    REBCNT n = hashes[hash];
+    REBCNT n = (slot == NOT_FOUND) ? 0 : HASH_SLOTS(hashlist)[slot].index;
 
     // n==0 or pairlist[(n-1)*]=~key
 
@@ -321,6 +564,30 @@ static REBCNT Find_Map_Entry(
     if (!Is_Value_Immutable(key))
         fail (Error_Map_Key_Unlocked_Raw(key));
 
+    if (IS_VOID(val)) {
+        if (n == 0)
+            return 0; // trying to remove non-existing key
+
+        // Remove the entry from the hashlist, so lookups never see it.  The
+        // pair stays where it is with a void value, as moving the pairs after
+        // it would disturb a FOR-EACH that is removing keys as it goes.  The
+        // gaps are closed by Rehash_Map() instead of growing the hashlist.
+        //
+        Remove_Hash_Slot(hashlist, slot);
+        Init_Void(ARR_AT(pairlist, (n - 1) * 2 + 1));
+        ++SER(pairlist)->misc.removed;
+
+        // Removed pairs at the tail can just be dropped.
+        //
+        REBCNT len = ARR_LEN(pairlist);
+        while (len != 0 && IS_VOID(ARR_AT(pairlist, len - 1))) {
+            len -= 2;
+            --SER(pairlist)->misc.removed;
+        }
+        TERM_ARRAY_LEN(pairlist, len);
+        return 0;
+    }
+
     // Must set the value:
     if (n) {  // re-set it:
         Derelativize(
@@ -331,7 +598,16 @@ static REBCNT Find_Map_Entry(
         return n;
     }
 
-    if (IS_VOID(val)) return 0; // trying to remove non-existing key
+    // Keep the hashlist at most half full, so probe sequences stay short.
+    // If a quarter of the pairs have been removed, closing their gaps makes
+    // enough room instead.
+    //
+    if (ARR_LEN(pairlist) + 2 > SER_LEN(hashlist)) {
+        if (SER(pairlist)->misc.removed > ARR_LEN(pairlist) / 8)
+            Rehash_Map(map);
+        if (ARR_LEN(pairlist) + 2 > SER_LEN(hashlist))
+            Expand_Hash(hashlist);
+    }
 
     // Create new entry.  Note that it does not copy underlying series (e.g.
     // the data of a string), which is why the immutability test is necessary
@@ -339,7 +615,9 @@ static REBCNT Find_Map_Entry(
     Append_Value_Core(pairlist, key, key_specifier);
     Append_Value_Core(pairlist, val, val_specifier);
 
-    return (hashes[hash] = (ARR_LEN(pairlist) / 2));
+    n = ARR_LEN(pairlist) / 2;
+    Insert_Hash_Slot(hashlist, hash, n);
+    return n;
 }
 
 
@@ -471,7 +749,6 @@ void TO_Map(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
 
     REBMAP *map = Make_Map(len / 2); // [key value key value...] + END
     Append_Map(map, array, index, specifier, len);
-    Rehash_Map(map);
     Init_Map(out, map);
 }
 
@@ -730,6 +1007,7 @@ REBTYPE(Map)
         FAIL_IF_READ_ONLY_ARRAY(MAP_PAIRLIST(map));
 
         Reset_Array(MAP_PAIRLIST(map));
+        SER(MAP_PAIRLIST(map))->misc.removed = 0;
 
         // !!! Review: should the space for the hashlist be reclaimed?  This
         // clears all the indices but doesn't scale back the size.
@@ -549,7 +549,8 @@ static void Sort_String(
     REBVAL *skipv,
     REBVAL *compv,
     REBVAL *part,
-    REBOOL rev
+    REBOOL rev,
+    REBOOL stable
 ) {
     if (!IS_VOID(compv))
         fail (Error_Bad_Refine_Raw(compv)); // !!! didn't seem to be supported (?)
@@ -577,13 +578,27 @@ static void Sort_String(
     if (ccase) thunk |= CC_FLAG_CASE;
     if (rev) thunk |= CC_FLAG_REVERSE;
 
-    reb_qsort_r(
+    size *= SER_WIDE(VAL_SERIES(string));
+
+    REBCNT threads = Sort_Threads(len);
+
+    if (NOT(stable) && threads == 1) {
+        reb_qsort_r(VAL_RAW_DATA_AT(string), len, size, &thunk, Compare_Chr);
+        return;
+    }
+
+    REBSER *temp = Make_Binary(len * size);
+    Parallel_Merge_Sort(
         VAL_RAW_DATA_AT(string),
+        BIN_HEAD(temp),
         len,
-        size * SER_WIDE(VAL_SERIES(string)),
+        size,
         &thunk,
-        Compare_Chr
+        Compare_Chr,
+        FALSE,
+        threads
     );
+    Free_Series(temp);
 }
 
 
@@ -1172,7 +1187,8 @@ REBTYPE(String)
             ARG(size), // skip size (void if not /SKIP)
             ARG(comparator), // (void if not /COMPARE)
             ARG(limit),   // (void if not /PART)
-            REF(reverse)
+            REF(reverse),
+            REF(stable)
         );
         break; }
 
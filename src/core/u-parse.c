@@ -393,6 +393,243 @@ static const RELVAL *Get_Parse_Value(
 }
 
 
+// Rule blocks like `["GET" ... | "PUT" ... | "POST" ... | ...]` are often run
+// many times over.  When an alternative fails, the rest of it is walked to
+// the BAR! that starts the next one.  So the BAR! positions in rule blocks
+// are cached, keyed by the block's array, and the leading alternatives that
+// can be seen to fail from their first rule are skipped without being run.
+//
+// An entry is only trusted while the array has ARRAY_INFO_PARSE_ALTS (which
+// is cleared by changes that move or overwrite its values) and still has the
+// length it had when the BAR!s were found.  A new array starts without the
+// flag, so an entry left by a freed array at the same address isn't used.
+//
+#define PARSE_ALTS_SIZE 64 // slots in TG_Parse_Alts, a power of 2
+
+
+//
+//  Startup_Parse: C
+//
+void Startup_Parse(void)
+{
+    TG_Parse_Alts = ALLOC_N_ZEROFILL(REB_PARSE_ALTS, PARSE_ALTS_SIZE);
+}
+
+
+//
+//  Shutdown_Parse: C
+//
+void Shutdown_Parse(void)
+{
+    REBCNT n;
+    for (n = 0; n < PARSE_ALTS_SIZE; ++n) {
+        REB_PARSE_ALTS *alts = &TG_Parse_Alts[n];
+        if (alts->bars != NULL)
+            FREE_N(REBCNT, alts->num_bars, alts->bars);
+    }
+    FREE_N(REB_PARSE_ALTS, PARSE_ALTS_SIZE, TG_Parse_Alts);
+    TG_Parse_Alts = NULL;
+}
+
+
+//
+//  Get_Parse_Alts: C
+//
+// Get the positions of the BAR!s in a rule block, finding them again if they
+// aren't in the cache or the block has changed since they were found.
+//
+static REB_PARSE_ALTS *Get_Parse_Alts(REBARR *rules)
+{
+    REBUPT hash = cast(REBUPT, rules) / sizeof(REBSER);
+    REB_PARSE_ALTS *alts = &TG_Parse_Alts[hash & (PARSE_ALTS_SIZE - 1)];
+
+    if (
+        alts->rules == rules
+        && GET_SER_INFO(rules, ARRAY_INFO_PARSE_ALTS)
+        && alts->len == ARR_LEN(rules)
+    ){
+        return alts;
+    }
+
+    if (alts->bars != NULL)
+        FREE_N(REBCNT, alts->num_bars, alts->bars);
+
+    REBCNT num_bars = 0;
+    RELVAL *item;
+    for (item = ARR_HEAD(rules); NOT_END(item); ++item) {
+        if (IS_BAR(item))
+            ++num_bars;
+    }
+
+    alts->rules = rules;
+    alts->len = ARR_LEN(rules);
+    alts->num_bars = num_bars;
+
+    if (num_bars == 0)
+        alts->bars = NULL;
+    else {
+        alts->bars = ALLOC_N(REBCNT, num_bars);
+
+        REBCNT n = 0;
+        for (item = ARR_HEAD(rules); NOT_END(item); ++item) {
+            if (IS_BAR(item))
+                alts->bars[n++] = item - ARR_HEAD(rules);
+        }
+    }
+
+    SET_SER_INFO(rules, ARRAY_INFO_PARSE_ALTS);
+    return alts;
+}
+
+
+//
+//  Literal_Cannot_Match: C
+//
+// Tell if a rule is a literal which Parse_String_One_Rule() would fail to
+// match at the parse position, from its first character.  FALSE if it isn't
+// such a literal, if it has to be tried to know, or if the input is an array.
+//
+inline static REBOOL Literal_Cannot_Match(REBFRM *f, const RELVAL *rule)
+{
+    enum Reb_Kind kind = VAL_TYPE(rule);
+    switch (kind) {
+    case REB_CHAR:
+    case REB_STRING:
+    case REB_BINARY:
+    case REB_EMAIL:
+    case REB_FILE:
+    case REB_TAG:
+    case REB_BITSET:
+        break;
+
+    default:
+        return FALSE;
+    }
+
+    if (GET_SER_FLAG(P_INPUT, SERIES_FLAG_ARRAY))
+        return FALSE;
+
+    if (P_POS >= SER_LEN(P_INPUT))
+        return TRUE;
+
+    REBUNI ch = GET_ANY_CHAR(P_INPUT, P_POS);
+
+    switch (kind) {
+    case REB_CHAR:
+        if (P_HAS_CASE)
+            return LOGICAL(VAL_CHAR(rule) != ch);
+        return LOGICAL(UP_CASE(VAL_CHAR(rule)) != UP_CASE(ch));
+
+    case REB_TAG:
+        return LOGICAL(ch != '<');
+
+    case REB_BITSET:
+        return NOT(Check_Bit(VAL_SERIES(rule), ch, NOT(P_HAS_CASE)));
+
+    default: {
+        if (VAL_LEN_AT(rule) == 0)
+            return FALSE;
+
+        // Compare the first characters as Find_Str_Str() does
+        //
+        REBUNI first = GET_ANY_CHAR(VAL_SERIES(rule), VAL_INDEX(rule));
+        if (NOT(P_HAS_CASE)) {
+            if (ch < UNICODE_CASES)
+                ch = LO_CASE(ch);
+            if (first < UNICODE_CASES)
+                first = LO_CASE(first);
+        }
+        return LOGICAL(first != ch); }
+    }
+}
+
+
+//
+//  Skip_Failing_Alternatives: C
+//
+// Called when a rule block starts with a literal that Literal_Cannot_Match(),
+// and there are no pending flags or counts (so the first alternative fails).
+// The rules are moved on to the next alternative whose first rule might
+// match.  Returns FALSE if there isn't one, so the rules have failed.
+//
+// The rules have to be read from an array at f->index, which is not the case
+// if the frame is fed by a C va_list.
+//
+static REBOOL Skip_Failing_Alternatives(REBFRM *f)
+{
+    REBARR *rules = f->source.array;
+    REB_PARSE_ALTS *alts = Get_Parse_Alts(rules);
+
+    // Binary search for the first BAR! after the current rule
+    //
+    REBCNT index = f->index - 1;
+    REBCNT lo = 0;
+    REBCNT hi = alts->num_bars;
+    while (lo < hi) {
+        REBCNT mid = lo + (hi - lo) / 2;
+        if (alts->bars[mid] <= index)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // Each alternative after that starts after the next BAR!.  An END or a
+    // BAR! right after one is an empty alternative, which matches.
+    //
+    for (; lo < alts->num_bars; ++lo) {
+        REBCNT bar = alts->bars[lo];
+        SET_FRAME_VALUE(f, ARR_AT(rules, bar + 1));
+        f->index = bar + 2;
+
+        if (IS_END(P_RULE) || NOT(Literal_Cannot_Match(f, P_RULE)))
+            return TRUE;
+    }
+
+    return FALSE; // no alternatives left
+}
+
+
+//
+//  Match_Tag_At: C
+//
+// A TAG! rule matches the text it FORMs to, which is its content between a
+// `<` and `>` that aren't in its series.  This matches that text at `index`
+// without making it, returning the index after the `>` or NOT_FOUND.
+//
+static REBCNT Match_Tag_At(
+    REBSER *input,
+    REBCNT index,
+    const RELVAL *tag,
+    REBCNT find_flags
+) {
+    REBCNT tail = SER_LEN(input);
+
+    if (index >= tail || GET_ANY_CHAR(input, index) != '<')
+        return NOT_FOUND;
+    ++index;
+
+    if (VAL_LEN_AT(tag) != 0) {
+        index = Find_Str_Str(
+            input,
+            0,
+            index,
+            tail,
+            1,
+            VAL_SERIES(tag),
+            VAL_INDEX(tag),
+            VAL_LEN_AT(tag),
+            find_flags | AM_FIND_MATCH | AM_FIND_TAIL
+        );
+        if (index == NOT_FOUND)
+            return NOT_FOUND;
+    }
+
+    if (index >= tail || GET_ANY_CHAR(input, index) != '>')
+        return NOT_FOUND;
+    return index + 1;
+}
+
+
 //
 //  Parse_String_One_Rule: C
 //
@@ -443,6 +680,7 @@ static REBIXO Parse_String_One_Rule(REBFRM *f, const RELVAL *rule) {
         return END_FLAG;
 
     case REB_EMAIL:
+    case REB_FILE: // these FORM to the text in their series, as-is
     case REB_STRING:
     case REB_BINARY: {
         REBCNT index = Find_Str_Str(
@@ -460,25 +698,8 @@ static REBIXO Parse_String_One_Rule(REBFRM *f, const RELVAL *rule) {
             return END_FLAG;
         return index; }
 
-    case REB_TAG:
-    case REB_FILE: {
-        //
-        // !!! The content to be matched does not have the delimiters in the
-        // actual series data.  This FORMs it, but could be more optimized.
-        //
-        REBSER *formed = Copy_Form_Value(rule, 0);
-        REBCNT index = Find_Str_Str(
-            P_INPUT,
-            0,
-            P_POS,
-            SER_LEN(P_INPUT),
-            1,
-            formed,
-            0,
-            SER_LEN(formed),
-            flags
-        );
-        Free_Series(formed);
+    case REB_TAG: {
+        REBCNT index = Match_Tag_At(P_INPUT, P_POS, rule, P_FIND_FLAGS);
         if (index == NOT_FOUND)
             return END_FLAG;
         return index; }
@@ -854,30 +1075,10 @@ static REBIXO To_Thru_Block_Rule(
                     }
                 }
                 else if (IS_TAG(rule)) {
-                    if (ch == '<') {
-                        //
-                        // !!! This code was adapted from Parse_to, and is
-                        // inefficient in the sense that it forms the tag
-                        //
-                        REBSER *formed = Copy_Form_Value(rule, 0);
-                        REBCNT len = SER_LEN(formed);
-                        REBCNT i = Find_Str_Str(
-                            P_INPUT,
-                            0,
-                            pos,
-                            SER_LEN(P_INPUT),
-                            1,
-                            formed,
-                            0,
-                            len,
-                            AM_FIND_MATCH | P_FIND_FLAGS
-                        );
-                        Free_Series(formed);
-                        if (i != NOT_FOUND) {
-                            pos = i;
-                            if (is_thru) pos += len;
-                            goto found;
-                        }
+                    REBCNT i = Match_Tag_At(P_INPUT, pos, rule, P_FIND_FLAGS);
+                    if (i != NOT_FOUND) {
+                        if (is_thru) pos = i;
+                        goto found;
                     }
                 }
                 else if (ANY_STRING(rule)) {
@@ -1028,32 +1229,20 @@ static REBIXO To_Thru_Non_Block_Rule(
     //=//// PARSE INPUT IS A STRING OR BINARY, USE A FIND ROUTINE /////////=//
 
     if (ANY_BINSTR(rule)) {
-        if (!IS_STRING(rule) && !IS_BINARY(rule)) {
-            // !!! Can this be optimized not to use COPY?
-            REBSER *formed = Copy_Form_Value(rule, 0);
-            REBCNT form_len = SER_LEN(formed);
-            REBCNT i = Find_Str_Str(
-                P_INPUT,
-                0,
-                P_POS,
-                SER_LEN(P_INPUT),
-                1,
-                formed,
-                0,
-                form_len,
-                (P_FIND_FLAGS & AM_FIND_CASE)
-                    ? AM_FIND_CASE
-                    : 0
-            );
-            Free_Series(formed);
-
-            if (i == NOT_FOUND)
-                return END_FLAG;
-
-            if (is_thru)
-                return i + form_len;
-
-            return i;
+        if (IS_TAG(rule)) {
+            //
+            // Other strings FORM to the text in their series, as-is, and can
+            // be searched for below.  A tag's text has a `<` and `>` added.
+            //
+            REBCNT i;
+            for (i = P_POS; i < SER_LEN(P_INPUT); ++i) {
+                REBCNT tail = Match_Tag_At(
+                    P_INPUT, i, rule, P_FIND_FLAGS & AM_FIND_CASE
+                );
+                if (tail != NOT_FOUND)
+                    return is_thru ? tail : i;
+            }
+            return END_FLAG;
         }
 
         REBCNT i = Find_Str_Str(
@@ -1343,6 +1532,23 @@ REBNATIVE(subparse)
     REBINT mincount = 1; // min pattern count
     REBINT maxcount = 1; // max pattern count
 
+    // Leading alternatives that can't match are skipped (unless they should
+    // be seen being tried by TRACE).  This isn't done again when a later one
+    // fails, as the check costs more than it saves in blocks like `["/a" |
+    // "/b" | ...]` where the first characters are all the same.
+    //
+    if (
+        f->pending == NULL
+        && P_RULE == ARR_AT(f->source.array, f->index - 1)
+        && Trace_Level == 0
+        && NOT_END(P_RULE)
+        && Literal_Cannot_Match(f, P_RULE)
+        && NOT(Skip_Failing_Alternatives(f))
+    ){
+        Init_Blank(P_OUT);
+        return R_OUT;
+    }
+
     while (NOT_END(P_RULE)) {
         //
         // The rule in the block of rules can be literal, while the "real
@@ -77,6 +77,25 @@
 };
 
 
+/***********************************************************************
+**
+*/  typedef struct rebol_node_magazine
+/*
+**      A few free nodes of a pool, held apart from its free list so that
+**      Make_Node() and Free_Node() only go to the pool in batches.
+**
+***********************************************************************/
+{
+    REBNOD  *top;               // next node to hand out (NULL if empty)
+    REBNOD  *bottom;            // last node in the chain from top
+    REBCNT  count;              // number of nodes in the chain
+} REBMAG;
+
+// Most nodes a magazine is loaded with, or holds before it is unloaded
+//
+#define MAGAZINE_SIZE 32
+
+
 /***********************************************************************
 **
 */  enum Mem_Pool_Specs
@@ -86,7 +105,7 @@
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL   + 16,
     MEM_MID_POOLS   = MEM_SMALL_POOLS +  4,
-    MEM_BIG_POOLS   = MEM_MID_POOLS   +  4, // larger pools
+    MEM_BIG_POOLS   = MEM_MID_POOLS   +  8, // larger pools
     SER_POOL     = MEM_BIG_POOLS,
     GOB_POOL,
     SYSTEM_POOL,
@@ -99,4 +118,8 @@
 #define MEM_MIN_SIZE sizeof(REBVAL)
 #define MEM_BIG_SIZE 1024
 
+// Largest allocation served from a pool (bigger ones come from Alloc_Mem)
+//
+#define MEM_POOLED_MAX (MEM_BIG_SIZE * (MEM_BIG_POOLS - MEM_MID_POOLS))
+
 #define MEM_BALLAST 3000000
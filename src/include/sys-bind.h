@@ -298,7 +298,17 @@ inline static REBVAL *Get_Var_Core(
     assert(VAL_WORD_CANON(any_word) == VAL_KEY_CANON(key));
 #endif
 
-    if (CTX_VARS_UNAVAILABLE(context)) {
+    // This is CTX_VAR() with its checks folded together, so that a fetch
+    // from an ordinary object tests one info bit on the way to the variable.
+    // Words bound relatively in function bodies will take the second path.
+    //
+    REBARR *varlist = CTX_VARLIST(context);
+    REBVAL *var;
+    if (NOT(GET_SER_INFO(varlist, CONTEXT_INFO_STACK)))
+        var = KNOWN(ARR_AT(varlist, index));
+    else if (NOT(GET_SER_INFO(varlist, SERIES_INFO_INACCESSIBLE)))
+        var = CTX_FRAME_IF_ON_STACK(context)->args_head + index - 1;
+    else {
         //
         // Currently if a context has a stack component, then the vars
         // are "all stack"...so when that level is popped, all the vars
@@ -321,7 +331,7 @@ inline static REBVAL *Get_Var_Core(
         fail (Error_No_Relative_Raw(unbound));
     }
 
-    REBVAL *var = CTX_VAR(context, index);
+    assert(var == CTX_VAR(context, index));
 
     if (flags & GETVAR_MUTABLE) {
         //
@@ -299,8 +299,84 @@ typedef struct rebol_stats {
     REBCNT  Mark_Count;
     REBCNT  Blocks;
     REBCNT  Objects;
+    REBI64  Word_Fetch_Hits; // Do_Core() reused a lookahead fetch, see gotten
+    REBI64  Word_Fetch_Misses; // Do_Core() had to look the variable up
 } REB_STATS;
 
+//-- Garbage collector pause timing (microseconds), see Recycle_Core():
+//
+// Unlike REB_STATS, these are kept in release builds as well.  Reading the
+// clock twice per recycle is cheap relative to the recycle itself, and
+// knowing how long the GC stalls is of interest to those tuning deployed
+// systems...who are not likely to be running debug builds.
+//
+typedef struct rebol_gc_stats {
+    REBCNT  Recycles;
+    REBI64  Pause_Last;
+    REBI64  Pause_Max;
+    REBI64  Pause_Total;
+    REBI64  Mark_Last;
+    REBI64  Sweep_Last;
+    REBCNT  Swept_Last; // managed series freed by last sweep
+    REBCNT  Survived_Last; // managed series that survived last sweep
+    REBI64  Live_Bytes; // Alloc_Mem() bytes not sitting free in pools
+    REBI64  Released_Bytes; // pool segments given back to the system
+} REB_GC_STATS;
+
+//-- Sampled series allocations, see PROFILE-ALLOCATIONS:
+//
+typedef struct rebol_alloc_sample {
+    REBSTR  *label; // running function (NULL if none, or for an empty slot)
+    REBCNT  kind; // what the series is used for, see %d-profile.c
+    REBCNT  used; // nonzero if this slot of the table is in use
+    REBI64  count; // number of allocations sampled
+    REBI64  bytes; // node and data bytes of the allocations sampled
+} REB_ALLOC_SAMPLE;
+
+//-- Sampled call stacks, see PROFILE:
+//
+typedef struct rebol_frame_sample {
+    REBSTR  *label; // function running (NULL if anonymous)
+    REBSTR  *file; // file of the array it was called from (NULL if unknown)
+    REBCNT  line; // line that array starts on (0 if unknown)
+} REB_FRAME_SAMPLE;
+
+typedef struct rebol_stack_sample {
+    REBCNT  hash; // of all the frames, kept for growing the table
+    REBCNT  start; // index of the outermost frame in TG_Frame_Samples
+    REBCNT  depth; // number of frames, which are stored outermost first
+    REBCNT  used; // nonzero if this slot of the table is in use
+    REBI64  count; // number of times the stack was sampled
+} REB_STACK_SAMPLE;
+
+//-- Timed function calls, see PROFILE-FUNCTIONS:
+//
+typedef struct rebol_func_timing {
+    REBFUN  *fun; // function called (NULL once the GC has freed it)
+    REBSTR  *label; // label it was first called with (NULL if anonymous)
+    REBOOL  used; // TRUE if this slot of the table is in use
+    REBCNT  active; // calls in progress, so recursion isn't counted twice
+    REBI64  calls; // number of calls
+    REBI64  self; // microseconds not spent in other timed calls
+    REBI64  total; // microseconds from the outermost calls to their returns
+} REB_FUNC_TIMING;
+
+typedef struct rebol_timing_call {
+    REBFUN  *fun; // function being run (f->original of the frame)
+    REBI64  start; // OS_DELTA_TIME() when the call started
+    REBI64  children; // microseconds spent in timed calls made by this one
+    REBOOL  outermost; // not a recursion of a call already in progress
+} REB_TIMING_CALL;
+
+//-- Alternatives of PARSE rule blocks, see %u-parse.c:
+//
+typedef struct rebol_parse_alts {
+    REBARR  *rules; // rule block (NULL for an empty slot of the cache)
+    REBCNT  len; // length of the block when its BAR!s were found
+    REBCNT  num_bars; // number of BAR!s in the block
+    REBCNT  *bars; // their indices in the block, in order (NULL if none)
+} REB_PARSE_ALTS;
+
 //-- Options of various kinds:
 typedef struct rebol_opts {
     REBOOL  watch_recycle;
@@ -493,6 +569,12 @@ enum rebol_signals {
     //
     SIG_RECYCLE,
 
+    // SIG_SWEEP asks for a lazy recycle's pending sweep to be advanced, as
+    // the SER_POOL ran out of nodes.  Like SIG_RECYCLE it is raised during
+    // allocation, where freeing series could be just as dangerous.
+    //
+    SIG_SWEEP,
+
     // SIG_HALT means return to the topmost level of the evaluator, regardless
     // of how deep a debug stack might be.  It is the only instruction besides
     // QUIT and RESUME that can currently get past a breakpoint sandbox.
@@ -509,6 +591,11 @@ enum rebol_signals {
     //
     SIG_EVENT_PORT,
 
+    // SIG_PROFILE is set by the timer of the sampling profiler, to ask for
+    // the function frames on the stack to be tallied (see PROFILE).
+    //
+    SIG_PROFILE,
+
     SIG_MAX
 };
 
@@ -58,10 +58,8 @@ PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 //
 PVAR REBSTR *PG_Symbol_Canons; // Canon symbol pointers for words in %words.r
 PVAR REBSTR *PG_Canons_By_Hash; // Canon REBSER pointers indexed by hash
-PVAR REBCNT PG_Num_Canon_Slots_In_Use; // Total canon hash slots (+ deleteds)
-#if !defined(NDEBUG)
-    PVAR REBCNT PG_Num_Canon_Deleteds; // Deleted canon hash slots "in use"
-#endif
+PVAR REBSER *PG_Canon_Hashes; // Full Hash_Word() of each canon in the table
+PVAR REBCNT PG_Num_Canon_Slots_In_Use; // Total canon hash slots in use
 
 //-- Main contexts:
 PVAR REBARR *PG_Root_Array; // Frame that holds Root_Vars
@@ -124,6 +122,7 @@ PVAR REBVAL PG_Write_Action;
 //
 PVAR REBDOF PG_Do; // Rebol "DO function" (takes REBFRM, returns void)
 PVAR REBAPF PG_Apply; // Rebol "APPLY function" (takes REBFRM, returns REB_R)
+PVAR REBAPF PG_Timed_Apply; // what PROFILE-FUNCTIONS' hook applies through
 
 
 /***********************************************************************
@@ -139,12 +138,45 @@ TVAR REBVAL TG_Thrown_Arg;  // Non-GC protected argument to THROW
 
 //-- Memory and GC:
 TVAR REBPOL *Mem_Pools;     // Memory pool array
+TVAR struct rebol_node_magazine *Node_Magazines; // Free nodes per pool
 TVAR REBOOL GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
 TVAR REBOOL GC_Disabled;      // TRUE when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
+TVAR REB_GC_STATS GC_Stats; // Pause timings of the collector (see STATS)
+TVAR struct rebol_mem_segment *GC_Sweep_Next; // Next segment to lazy sweep
+TVAR REBOOL GC_Sweeping;    // True while a lazy sweep is doing a segment
+TVAR REBSER *GC_Premarked;  // Nodes marked live for a pending lazy sweep
+
+//-- Allocation profiler (see %d-profile.c):
+TVAR REBCNT TG_Alloc_Sample_Countdown; // Allocations to next sample, 0 if off
+TVAR REBCNT TG_Alloc_Sample_Rate; // Sample one allocation in this many
+TVAR REB_ALLOC_SAMPLE *TG_Alloc_Samples; // Hash table of samples by label
+TVAR REBCNT TG_Alloc_Samples_Size; // Number of slots in the table
+TVAR REBCNT TG_Alloc_Samples_Used; // Slots in use
+
+//-- Call stack profiler (see %d-profile.c):
+TVAR REBOOL TG_Profiling; // TRUE while the sampling timer is running
+TVAR REB_STACK_SAMPLE *TG_Stack_Samples; // Hash table of distinct stacks
+TVAR REBCNT TG_Stack_Samples_Size; // Number of slots in the table
+TVAR REBCNT TG_Stack_Samples_Used; // Slots in use
+TVAR REB_FRAME_SAMPLE *TG_Frame_Samples; // Frames of the sampled stacks
+TVAR REBCNT TG_Frame_Samples_Size; // Number of frames there is room for
+TVAR REBCNT TG_Frame_Samples_Used; // Frames in use
+
+//-- Function call timer (see %d-profile.c):
+TVAR REB_FUNC_TIMING *TG_Func_Timings; // Hash table of timings by function
+TVAR REBCNT TG_Func_Timings_Size; // Number of slots in the table
+TVAR REBCNT TG_Func_Timings_Used; // Slots in use
+TVAR REB_TIMING_CALL *TG_Timing_Calls; // Stack of timed calls in progress
+TVAR REBCNT TG_Timing_Calls_Size; // Number of calls there is room for
+TVAR REBCNT TG_Timing_Depth; // Timed calls in progress
+TVAR REBCNT TG_Timing_Base; // Calls below this began before the table did
+
+//-- PARSE (see %u-parse.c):
+TVAR REB_PARSE_ALTS *TG_Parse_Alts; // Cache of BAR! positions in rule blocks
 
 TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
 
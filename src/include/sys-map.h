@@ -34,19 +34,32 @@
 // made and the array is searched linearly.  This is indicated by the hashlist
 // being NULL.
 //
+// Each slot of the hashlist holds the 1-based index of a key/value pair along
+// with the hash of its key, so that probing can skip slots whose hashes don't
+// match without looking at the pairlist.  Removing a key takes it out of the
+// hashlist, shifting the entries after it back, so lookups don't have to step
+// over it.  But its pair is left in the pairlist with a void value, so that
+// the pairs don't move while a loop may be enumerating them.  The pairlist's `misc.removed` counts these, and
+// they are closed up (keeping the order of the rest) when the hashlist would
+// otherwise have to grow.
+//
 // Though maps are not considered a series in the "ANY-SERIES!" value sense,
 // they are implemented using series--and hence are in %sys-series.h, at least
 // until a better location for the definition is found.
 //
-// !!! Should there be a MAP_LEN()?  Current implementation has NONE in
-// slots that are unused, so can give a deceptive number.  But so can
-// objects with hidden fields, locals in paramlists, etc.
-//
 
 struct Reb_Map {
     struct Reb_Array pairlist; // hashlist is held in ->link.hashlist
 };
 
+struct Reb_Hash_Slot {
+    REBCNT hash; // hash of the key, mixed so its low bits pick the slot
+    REBCNT index; // 1-based index of the record, 0 if slot unused
+};
+
+#define HASH_SLOTS(hashlist) \
+    SER_HEAD(struct Reb_Hash_Slot, (hashlist))
+
 inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
     assert(GET_SER_FLAG(&(m)->pairlist, ARRAY_FLAG_PAIRLIST));
     return (&(m)->pairlist);
@@ -55,8 +68,8 @@ inline static REBARR *MAP_PAIRLIST(REBMAP *m) {
 #define MAP_HASHLIST(m) \
     (SER(MAP_PAIRLIST(m))->link.hashlist)
 
-#define MAP_HASHES(m) \
-    SER_HEAD(MAP_HASHLIST(m))
+#define MAP_HASH_SLOTS(m) \
+    HASH_SLOTS(MAP_HASHLIST(m))
 
 inline static REBMAP *MAP(void *p) {
     REBARR *a = ARR(p);
@@ -77,13 +90,6 @@ inline static REBMAP *VAL_MAP(const RELVAL *v) {
 
 inline static REBCNT Length_Map(REBMAP *map)
 {
-    REBVAL *v = KNOWN(ARR_HEAD(MAP_PAIRLIST(map)));
-
-    REBCNT count = 0;
-    for (; NOT_END(v); v += 2) {
-        if (!IS_VOID(v + 1))
-            ++count;
-    }
-
-    return count;
+    REBARR *pairlist = MAP_PAIRLIST(map);
+    return ARR_LEN(pairlist) / 2 - SER(pairlist)->misc.removed;
 }
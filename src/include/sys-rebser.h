@@ -101,7 +101,8 @@
 // they need to track.
 //
 // Note: ARRAY_FLAG_VARLIST also implies legality of voids, which
-// are used to represent unset variables.
+// are used to represent unset variables.  So does ARRAY_FLAG_PAIRLIST, where
+// they are the values of pairs whose keys were removed from a map.
 //
 #define ARRAY_FLAG_VOIDS_LEGAL \
     NODE_FLAG_SPECIAL
@@ -424,6 +425,31 @@
     FLAGIT_LEFT(12)
 
 
+//=//// ARRAY_INFO_HASHED /////////////////////////////////////////////////=//
+//
+// An array the user asked to keep a hash index for (see HASH-INDEX), so set
+// operations can look its values up without hashing it each time.  The index
+// is a hashlist like a MAP!'s, in the array's ->link field (so the array
+// can't have SERIES_FLAG_FILE_LINE).  It is NULL if the index is to be built
+// again before its next use, as it is after the array's values are changed
+// or moved.  The ->misc field says how many values at the head of the array
+// have been indexed, so values appended at the tail can be added to it.
+//
+#define ARRAY_INFO_HASHED \
+    FLAGIT_LEFT(14)
+
+
+//=//// ARRAY_INFO_PARSE_ALTS /////////////////////////////////////////////=//
+//
+// The positions of the BAR!s in this array, which separate alternatives when
+// it is used as PARSE rules, are in the cache that PARSE keeps of them (see
+// %u-parse.c).  Changes that move or overwrite the array's values clear it,
+// so the positions are found again.
+//
+#define ARRAY_INFO_PARSE_ALTS \
+    FLAGIT_LEFT(15)
+
+
 #if !defined(NDEBUG)
     //=//// SERIES_INFO_LEGACY_DEBUG //////////////////////////////////////=//
     //
@@ -445,7 +471,7 @@
 // flags need to stop at FLAGIT_LEFT(15).
 //
 #if defined(__cplusplus) && (__cplusplus >= 201103L)
-    static_assert(13 < 16, "SERIES_INFO_XXX too high");
+    static_assert(15 < 16, "SERIES_INFO_XXX too high");
 #endif
 
 
@@ -608,7 +634,7 @@ struct Reb_Series {
         //
         REBCTX *exemplar;
 
-        // The MAP! datatype uses this.
+        // The MAP! datatype uses this, as do arrays with ARRAY_INFO_HASHED.
         //
         REBSER *hashlist;
 
@@ -654,6 +680,16 @@ struct Reb_Series {
         //
         REBUPT line;
 
+        // Arrays with ARRAY_INFO_HASHED keep the number of values that are
+        // in their hash index here.
+        //
+        REBCNT hashed;
+
+        // MAP! pairlists keep the number of pairs that were removed, but are
+        // still in the pairlist (with void values) until Rehash_Map().
+        //
+        REBCNT removed;
+
         // native dispatcher code, see Reb_Function's body_holder
         //
         REBNAT dispatcher;
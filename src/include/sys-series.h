@@ -485,6 +485,17 @@ inline static REBOOL Is_Series_Frozen(REBSER *s) {
     return GET_SER_INFO(s, SERIES_INFO_FROZEN);
 }
 
+// Code which changes or moves values that are already in an array calls this
+// so that, if the array has a hash index or its BAR!s are in the PARSE cache,
+// they will be found again before they are used.  (Values added at the tail
+// don't need it.)
+//
+inline static void Invalidate_Array_Indexes(REBSER *s) {
+    if (GET_SER_INFO(s, ARRAY_INFO_HASHED))
+        s->link.hashlist = NULL;
+    CLEAR_SER_INFO(s, ARRAY_INFO_PARSE_ALTS);
+}
+
 inline static REBOOL Is_Series_Read_Only(REBSER *s) { // may be temporary...
     return ANY_SER_INFOS(
         s, SERIES_INFO_FROZEN | SERIES_INFO_HOLD | SERIES_INFO_PROTECTED
@@ -56,4 +56,5 @@ struct Reb_State {
     REBCNT manuals_len; // Where GC_Manuals was when state started
     REBCNT uni_buf_len;
     REBCNT mold_loop_tail;
+    REBCNT timing_depth; // Timed function calls in progress (see %d-profile.c)
 };
@@ -309,6 +309,48 @@ inline static void INIT_VAL_PARAM_CLASS(RELVAL *v, enum Reb_Param_Class c) {
 #define TS_CLONE \
     ((TS_SERIES | FLAGIT_KIND(REB_FUNCTION)) & ~TS_NOT_COPIED)
 
+// Types the evaluator gives back as-is (see the `inert:` case in Do_Core()).
+// BAR! and LIT-BAR! are left out, as they are treated specially.
+//
+#define TS_INERT \
+    (FLAGIT_KIND(REB_REFINEMENT) \
+    | FLAGIT_KIND(REB_ISSUE) \
+    | FLAGIT_KIND(REB_BLOCK) \
+    | FLAGIT_KIND(REB_BINARY) \
+    | FLAGIT_KIND(REB_STRING) \
+    | FLAGIT_KIND(REB_FILE) \
+    | FLAGIT_KIND(REB_EMAIL) \
+    | FLAGIT_KIND(REB_URL) \
+    | FLAGIT_KIND(REB_TAG) \
+    | FLAGIT_KIND(REB_BITSET) \
+    | FLAGIT_KIND(REB_IMAGE) \
+    | FLAGIT_KIND(REB_VECTOR) \
+    | FLAGIT_KIND(REB_MAP) \
+    | FLAGIT_KIND(REB_VARARGS) \
+    | FLAGIT_KIND(REB_OBJECT) \
+    | FLAGIT_KIND(REB_FRAME) \
+    | FLAGIT_KIND(REB_MODULE) \
+    | FLAGIT_KIND(REB_ERROR) \
+    | FLAGIT_KIND(REB_PORT) \
+    | FLAGIT_KIND(REB_BLANK) \
+    | FLAGIT_KIND(REB_LOGIC) \
+    | FLAGIT_KIND(REB_INTEGER) \
+    | FLAGIT_KIND(REB_DECIMAL) \
+    | FLAGIT_KIND(REB_PERCENT) \
+    | FLAGIT_KIND(REB_MONEY) \
+    | FLAGIT_KIND(REB_CHAR) \
+    | FLAGIT_KIND(REB_PAIR) \
+    | FLAGIT_KIND(REB_TUPLE) \
+    | FLAGIT_KIND(REB_TIME) \
+    | FLAGIT_KIND(REB_DATE) \
+    | FLAGIT_KIND(REB_DATATYPE) \
+    | FLAGIT_KIND(REB_TYPESET) \
+    | FLAGIT_KIND(REB_GOB) \
+    | FLAGIT_KIND(REB_EVENT) \
+    | FLAGIT_KIND(REB_HANDLE) \
+    | FLAGIT_KIND(REB_STRUCT) \
+    | FLAGIT_KIND(REB_LIBRARY))
+
 #define TS_ANY_WORD \
     (FLAGIT_KIND(REB_WORD) \
     | FLAGIT_KIND(REB_SET_WORD) \
@@ -182,7 +182,7 @@ delta-profile: func [
         end: next end
     ]
     start: construct system/standard/stats []
-    set start head end
+    set words-of start head end
     start
 ]
 
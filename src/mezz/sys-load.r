@@ -406,6 +406,121 @@ load: function [
 ]
 
 
+load-each: procedure [
+    {Loads the values of a file a piece at a time, calling a function with each.}
+    source [file! port!]
+        {File or open port to read from, which may be much larger than memory}
+    action [function!]
+        {Called with each top-level value, as soon as it has been read}
+    /batch
+        {Call the function with blocks of values instead of one at a time}
+        size [integer!]
+    /part
+        {Bytes to read at a time}
+        chunk [integer!]
+][
+    ; NOTES:
+    ; The values are not bound, as with LOAD/TYPE of 'UNBOUND, and a header
+    ; is not treated specially.  Only the input that hasn't been scanned into
+    ; values yet is kept, so memory use depends on the size of the largest
+    ; value rather than on the size of the file.
+    ;
+    ; The input is scanned up to its last line break that isn't inside of a
+    ; value, as found by TOP-LEVEL-BREAK.  Its pre-pass doesn't know tags,
+    ; so a value may still fail to scan because it goes on past what's been
+    ; read: then twice as much is read, and it's tried again.  A scan that
+    ; fails when the input has all been read is an error.
+
+    if all [batch | size < 1] [cause-error 'script 'invalid-arg size]
+    chunk: any [:chunk 65536]
+    if chunk < 1 [cause-error 'script 'invalid-arg chunk]
+
+    either port? port: source [
+        file: port/spec/ref
+    ][
+        file: source
+        port: open/read source
+    ]
+    unless maybe? [file! url!] :file [file: _]
+
+    pending: make binary! chunk ; read, but not yet scanned into values
+    line: 1 ; updated by TRANSCODE/LINE as it goes
+    values: if batch [make block! size]
+    want: chunk
+    at-end: false
+    bom: true
+
+    until [at-end] [
+        data: read/part port want
+        at-end: empty? data
+        append pending data
+
+        if all [bom | any [at-end | 3 <= length-of pending]] [
+            if #{EFBBBF} = copy/part pending 3 [
+                remove/part pending 3 ; UTF-8 byte order mark
+            ]
+            bom: false
+        ]
+
+        carry: either at-end [_] [
+            if not end: top-level-break pending [
+                want: max chunk length-of pending ; so it's not rescanned a lot
+                continue ; no complete value yet
+            ]
+            take/part end tail pending
+        ]
+
+        ; Usually the values before the break can all be scanned at once.
+        ; If not, take the values before the one that doesn't end (or is
+        ; bad) one at a time.
+        ;
+        pos: pending
+        result: either at-end [
+            transcode/file/line pos file 'line
+        ][
+            trap [transcode/file/line pos file 'line]
+        ]
+        either block? result [
+            take/last result ; the rest of the input, which is empty
+            pos: tail pos
+        ][
+            result: make block! 0
+            until [tail? pos] [
+                if error? rest: trap [
+                    transcode/next/file/line pos file 'line
+                ][
+                    break
+                ]
+                if 2 = length-of rest [append/only result first rest]
+                pos: last rest
+            ]
+        ]
+
+        either batch [
+            until [tail? result] [
+                n: min size - length-of values length-of result
+                append/part values result n
+                result: skip result n
+                if size = length-of values [
+                    action values
+                    values: make block! size
+                ]
+            ]
+        ][
+            for-each value result [action :value]
+        ]
+
+        want: either tail? pos [chunk] [max chunk length-of pos]
+        remove/part pending pos
+        if carry [append pending carry]
+    ]
+
+    if all [batch | not empty? values] [action values]
+
+    unless port? source [close port]
+]
+
+
 do-needs: function [
     "Process the NEEDS block of a program header. Returns unapplied mixins."
     needs [block! object! tuple! blank!]
@@ -1098,4 +1213,4 @@ unload-extension: procedure [
 ]
 
 
-export [load import load-extension unload-extension]
+export [load load-each import load-extension unload-extension]
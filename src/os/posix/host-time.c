@@ -185,10 +185,20 @@ i64 OS_Delta_Time(i64 base, int flags)
 {
     UNUSED(flags);
 
+    // A monotonic clock can't jump if the date is set while timing something
+    // (e.g. the function calls timed by PROFILE-FUNCTIONS).
+    //
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    i64 time = cast(i64, ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+#else
     struct timeval tv;
     gettimeofday(&tv,0);
 
     i64 time = cast(i64, tv.tv_sec * 1000000) + tv.tv_usec;
+#endif
     if (base == 0)
         return time;
 
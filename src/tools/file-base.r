@@ -46,6 +46,7 @@ core: [
     d-eval.c
     d-legacy.c
     d-print.c
+    d-profile.c
     d-stack.c
     d-trace.c
 
@@ -58,6 +59,7 @@ core: [
     f-int.c
     f-math.c
     f-modify.c
+    f-msort.c
     f-qsort.c
     f-random.c
     f-round.c
@@ -988,6 +988,59 @@ append app-config/cflags opt switch/default user-config/rigorous [
     fail ["RIGOROUS must be yes, no, or logic! not" (user-config/rigorous)]
 ]
 
+use-pthreads: false
+
+; Let large sorts be split across threads, see Parallel_Merge_Sort() in
+; %f-msort.c
+;
+if switch/default user-config/parallel-sort [
+    #[true] yes on true [
+        if system-config/os-base = 'windows [
+            fail "PARALLEL-SORT needs POSIX threads"
+        ]
+        true
+    ]
+    _ #[false] no off false [
+        false
+    ]
+][
+    fail [
+        "PARALLEL-SORT must be yes, no, or logic! not"
+        (user-config/parallel-sort)
+    ]
+][
+    append app-config/definitions ["PARALLEL_SORT"]
+    use-pthreads: true
+]
+
+; Let the sweep of a large heap be split across threads, see
+; Sweep_Series_Parallel() in %m-gc.c
+;
+if switch/default user-config/parallel-sweep [
+    #[true] yes on true [
+        if system-config/os-base = 'windows [
+            fail "PARALLEL-SWEEP needs POSIX threads"
+        ]
+        true
+    ]
+    _ #[false] no off false [
+        false
+    ]
+][
+    fail [
+        "PARALLEL-SWEEP must be yes, no, or logic! not"
+        (user-config/parallel-sweep)
+    ]
+][
+    append app-config/definitions ["PARALLEL_SWEEP"]
+    use-pthreads: true
+]
+
+if use-pthreads [
+    append app-config/cflags [<gnu:-pthread>]
+    append app-config/ldflags [<gnu:-pthread>]
+]
+
 append app-config/ldflags opt switch/default user-config/static [
     _ no off false #[false] [
         ;pass
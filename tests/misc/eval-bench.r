@@ -0,0 +1,145 @@
+REBOL [
+    Title: "Evaluator benchmark"
+    File: %eval-bench.r
+    Purpose: {
+        The Eratosthenes sieve, "four-banger" arithmetic, Gaussian quadrature
+        and merge sort kernels of %tests/bench.r3, brought up to date so they
+        run in this interpreter, and timed without prompting for input.  They
+        spend most of their time in the evaluator, calling short functions on
+        words and literals.
+    }
+    Usage: {r3 eval-bench.r}
+]
+
+rounds: 5
+
+sieve: func [size /local flags i prime series] [
+    flags: make block! size
+    insert/dup flags true size
+    while [not tail? flags] [
+        if first flags [
+            i: index-of flags
+            prime: i + i + 1
+            series: skip flags prime * i
+            while [not tail? series] [
+                change series false
+                series: skip series prime
+            ]
+        ]
+        flags: next flags
+    ]
+    head flags
+]
+
+fourbang: func [/local ten one temp] [
+    ten: 10.0
+    one: 1.0
+    temp: ten
+    loop 4 [
+        temp: temp + one
+        temp: temp - one
+        temp: temp * ten
+        temp: temp / ten
+        temp: temp - one
+        temp: temp * ten
+        temp: temp + ten
+        temp: temp / ten
+    ]
+    temp
+]
+
+gqf2: func [
+    "Gaussian quadrature formula of the second order"
+    f [function!]
+    a [number!]
+    b [number!]
+    n [integer!]
+    /local h m sum alpha beta sqrt3 halfh
+][
+    h: (b - a) / n
+    halfh: h / 2
+    m: 0
+    sum: 0
+    sqrt3: 1 / (square-root 3)
+    alpha: a + (halfh * (1 - sqrt3))
+    beta: a + (halfh * (1 + sqrt3))
+    while [n > m] [
+        sum: sum + (f alpha) + (f beta)
+        alpha: alpha + h
+        beta: beta + h
+        m: m + 1
+    ]
+    halfh * sum
+]
+
+msort: func [
+    "Merge-sort a series in place."
+    a [any-series!]
+    compare [function!]
+    /local msort-do merge
+][
+    msort-do: func [a l /local mid b] [
+        either l <= 2 [
+            unless any [l < 2 | compare first a second a] [
+                b: first a
+                change/only a second a
+                change/only next a b
+            ]
+        ][
+            mid: to integer! l / 2
+            msort-do a mid
+            msort-do skip a mid l - mid
+            merge a mid skip a mid l - mid
+        ]
+    ]
+    merge: func [a la b lb /local c] [
+        c: copy/part a la
+        loop-until [
+            either compare first b first c [
+                change/only a first b
+                b: next b
+                a: next a
+                zero? lb: lb - 1
+            ][
+                change/only a first c
+                c: next c
+                a: next a
+                empty? c
+            ]
+        ]
+        change a c
+    ]
+    msort-do a length-of a
+    a
+]
+
+; Report the best of a few rounds, as the others are more likely to have
+; been slowed down by something else running on the machine.
+;
+measure: proc [title [string!] count [integer!] code [block!] /local best t] [
+    best: _
+    loop rounds [
+        t: now/precise
+        loop count code
+        t: difference now/precise t
+        if any [blank? best | t < best] [best: t]
+    ]
+    print [title best]
+]
+
+random/seed 1
+numbers: random collect [repeat i 500 [keep i]]
+lesser-or-equal: func [a b] [a <= b]
+sine-radians: func [x] [sine x * 180 / pi]
+
+print ["Best of" rounds "rounds:"]
+
+measure "sieve (size 8190) x 20" 20 [sieve 8190]
+measure "four-banger x 100000" 100000 [fourbang]
+measure "integral of sin(x), 10000 steps x 20" 20 [
+    gqf2 :sine-radians 0 pi / 2 10000
+]
+measure "integral of exp(x), 10000 steps x 50" 50 [gqf2 :exp 0 1 10000]
+measure "merge sort (500 elements) x 50" 50 [
+    msort copy numbers :lesser-or-equal
+]
@@ -0,0 +1,70 @@
+REBOL [
+    Title: "Loop body allocation benchmark"
+    File: %loop-allocations.r
+    Purpose: {
+        Counts the series that FOR-EACH, REPEAT and FOR allocate when they
+        are run many times on a small body, by sampling every allocation
+        with PROFILE-ALLOCATIONS.  Each run of a loop makes an object for
+        its variables, and copies the body deeply so it can be bound to that
+        object (the copy also gives each run its own series literals).
+    }
+    Usage: {r3 loop-allocations.r}
+]
+
+runs: 10000
+
+total: func [report [block!] /local n] [
+    n: 0
+    for-each [label kind count bytes] report [n: n + count]
+    n
+]
+
+measure: proc [title [string!] code [block!] /local report t] [
+    recycle
+    t: now/precise
+    profile-allocations/on 1
+    do code
+    profile-allocations/off
+    t: difference now/precise t
+    report: profile-allocations
+    print [
+        pad title 36
+        pad total report 8 "series in"
+        t
+    ]
+]
+
+pad: func [value width] [
+    value: form value
+    head insert/dup tail value " " max 0 width - length-of value
+]
+
+data: [a b c d e f g h]
+n: 0
+
+print [runs "runs of each loop:"]
+
+measure "for-each, body unused var" [
+    loop runs [for-each x data [n: n + 1]]
+]
+measure "for-each, body uses var" [
+    loop runs [for-each x data [n: n + length-of form x]]
+]
+measure "repeat, nested body unused var" [
+    loop runs [repeat i 8 [either n > 0 [n: n - 1] [n: n + 1]]]
+]
+measure "repeat, nested body uses var" [
+    loop runs [repeat i 8 [either n > 0 [n: n - i] [n: n + i]]]
+]
+measure "for, body unused var" [
+    loop runs [for i 1 8 1 [n: n + 1]]
+]
+measure "for, body uses var" [
+    loop runs [for i 1 8 1 [n: n + i]]
+]
+measure "use, body unused var" [
+    loop runs [use [x] [n: n + 1]]
+]
+measure "use, body uses var" [
+    loop runs [use [x] [x: 1 n: n + x]]
+]
@@ -0,0 +1,55 @@
+REBOL [
+    Title: "Garbage collector ballast policy benchmark"
+    File: %recycle-growth.r
+    Purpose: {
+        Shows the tradeoff made by system/options/recycle-growth, which sets
+        how far the heap may grow past the data found live by a recycle
+        before the next automatic one is triggered.  A BLANK! setting keeps
+        the fixed RECYCLE/BALLAST behavior of R3-Alpha.
+
+        For each setting the same workload is run: a large set of blocks is
+        kept alive while short-lived garbage is churned.  The time taken,
+        the number of collections and their total pause are reported.  Then
+        one more recycle is run to show the live size and the ballast which
+        the policy grants (live + ballast being roughly the heap size the
+        program is allowed to reach before it is collected again).
+    }
+    Usage: {r3 recycle-growth.r}
+]
+
+live-blocks: 50'000
+churn-loops: 400'000
+
+kept: copy []
+repeat i live-blocks [append/only kept reduce [i form i copy "live"]]
+
+workload: [
+    loop churn-loops [
+        junk: reduce [copy "garbage" copy [a b c] make object! [x: 1]]
+    ]
+]
+
+print [
+    "growth" tab "time" tab "recycles" tab "pause-total" tab
+    "live-bytes" tab "ballast"
+]
+
+for-each growth [_ 25 100 400] [
+    system/options/recycle-growth: growth
+    recycle
+    before: stats/recycle
+    time: delta-time workload
+    after: stats/recycle
+    recycle
+    granted: stats/recycle
+    print [
+        either blank? growth ["fixed"] [growth] tab
+        time tab
+        after/recycles - before/recycles tab
+        after/pause-total - before/pause-total tab
+        granted/live-bytes tab
+        granted/ballast
+    ]
+]
+
+system/options/recycle-growth: 100
@@ -0,0 +1,102 @@
+REBOL [
+    Title: "Scanner throughput benchmark"
+    File: %scan-speed.r
+    Purpose: {
+        Times TRANSCODE on a few kinds of source, and reports how many
+        megabytes of UTF-8 the scanner gets through per second.
+
+        Three are mostly words, which makes the scanner dominated by
+        Intern_UTF8_Managed() looking up their spellings in the symbol table:
+        one where the same few words recur (lookups that hit), one where most
+        words are new (table insertions and growth), and one of long words in
+        mixed case (hashing and case-insensitive comparison of the spelling).
+
+        The others are data files: one of short records (words, numbers,
+        dates, emails and short strings), one mostly of long strings of prose
+        (some of it not ASCII) and one of indented source with comments,
+        which makes the scanner spend its time skipping over whitespace and
+        to the ends of lines.
+    }
+    Usage: {r3 scan-speed.r}
+]
+
+rounds: 5
+
+make-source: function [count [integer!] record [function!]] [
+    text: make string! count * 100
+    repeat i count [append text record i]
+    to binary! text
+]
+
+; The words are put ten to a block, as the scanner gathers the items of a
+; block on the data stack, and that has a limit.
+;
+ten-words: function [i [integer!] spelling [function!]] [
+    text: copy "["
+    repeat j 10 [
+        append text spelling i - 1 * 10 + j
+        append text either j = 10 ["]^/"] [space]
+    ]
+]
+
+prose: {The quick brown fox jumps over the lazy dog, then "naps" for a while.}
+accented: {Größere Übungen kosten 12€ — déjà vu, naïve café, señor.}
+
+sources: reduce [
+    "recurring" 40'000 func [i] [
+        ten-words i func [n] [
+            pick [append insert find select foo bar baz-mumble x y z] n // 10 + 1
+        ]
+    ]
+    "distinct" 20'000 func [i] [
+        ten-words i func [n] [rejoin ["word-" n]]
+    ]
+    "long-mixed" 20'000 func [i] [
+        ten-words i func [n] [
+            rejoin [
+                pick ["Some-Longer-Name-" "some-longer-NAME-" "SOME-longer-name-"]
+                    n // 3 + 1
+                n // 1000
+            ]
+        ]
+    ]
+    "records" 100'000 func [i] [
+        rejoin [
+            "[id " i " name " mold rejoin ["user-" i] " email user" i
+            "@example.com score " i // 97 * 1.5 " joined " 1-Jan-2000 + i
+            " tags [alpha beta gamma] active " either even? i ["yes"] ["no"]
+            "]^/"
+        ]
+    ]
+    "strings" 50'000 func [i] [
+        rejoin [
+            "[" i " " mold prose " {" prose "^/" accented "}]^/"
+        ]
+    ]
+    "indented" 50'000 func [i] [
+        rejoin [
+            "        ; step " i " of the loop, which doesn't do much at all^/"
+            "        if value-" i // 10 " [^/"
+            "            print [" mold prose "]^/"
+            "        ]^/^/"
+        ]
+    ]
+]
+
+print ["source" tab "megabytes" tab "best-time" tab "MB/sec"]
+
+for-each [name count record] sources [
+    source: make-source count :record
+    megabytes: (length-of source) / 1'000'000
+    best: _
+    loop rounds [
+        recycle
+        time: delta-time [transcode source]
+        if any [blank? best | time < best] [best: time]
+    ]
+    seconds: to decimal! best
+    print [
+        name tab round/to megabytes 0.1 tab best tab
+        either zero? seconds ["-"] [round/to megabytes / seconds 0.1]
+    ]
+]
@@ -155,3 +155,39 @@
 [not parse [1 + 2] [do [quote 100]]]
 [parse [reverse copy [a b c]] [do [into ['c 'b 'a]]]]
 [not parse [reverse copy [a b c]] [do [into ['a 'b 'c]]]]
+
+; Leading alternatives that can't match are skipped, these must still work
+
+[parse? "c" ["a" | "b" | "c"]]
+[parse? "C" ["a" | #"b" | "c"]]
+[not parse?/case "C" ["a" | #"b" | "c"]]
+[parse? "b" [["a" | | "c"] "b"]]
+[not parse? "d" ["a" | "b" | "c"]]
+[parse? "d" ["a" | "b" | (true) skip]]
+[parse? "xy" [#"a" | #"x" "y"]]
+[parse? "y" compose [<a> | (charset "xyz")]]
+[parse? "ab" [2 "b" | "ab"]]
+[parse? "" ["a" | "b" |]]
+[
+    rule: copy ["a" | "b"]
+    all [
+        not parse? "c" rule
+        append rule [| "c"]
+        parse? "c" rule
+        change next next rule "d"
+        not parse? "b" rule
+        parse? "d" rule
+    ]
+]
+
+; TAG! and FILE! rules match the text they FORM to
+
+[parse? "<a>" [<a>]]
+[not parse? "<a" [<a>]]
+[parse? "<A>" [<a>]]
+[not parse?/case "<A>" [<a>]]
+[parse? "x<a>y" [thru <a> "y"]]
+[parse? "x<a>y" [to <a> <a> "y"]]
+[parse? "x<a>y" [thru [<b> | <a>] "y"]]
+[parse? "a/b.txt" [%a/b.txt]]
+[parse? "xa/b" [thru %a/b]]